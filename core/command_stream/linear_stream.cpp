@@ -11,8 +11,13 @@
 
 namespace NEO {
 
+uint64_t LinearStream::acquireBufferGeneration() {
+    static std::atomic<uint64_t> bufferGenerationCounter{0};
+    return ++bufferGenerationCounter;
+}
+
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation, void *buffer, size_t bufferSize)
-    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(gfxAllocation) {
+    : sizeUsed(0), maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(gfxAllocation), bufferGeneration(acquireBufferGeneration()) {
 }
 
 LinearStream::LinearStream(void *buffer, size_t bufferSize)
@@ -20,7 +25,7 @@ LinearStream::LinearStream(void *buffer, size_t bufferSize)
 }
 
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation)
-    : sizeUsed(0), graphicsAllocation(gfxAllocation) {
+    : sizeUsed(0), graphicsAllocation(gfxAllocation), bufferGeneration(acquireBufferGeneration()) {
     if (gfxAllocation) {
         maxAvailableSpace = gfxAllocation->getUnderlyingBufferSize();
         buffer = gfxAllocation->getUnderlyingBuffer();
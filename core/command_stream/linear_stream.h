@@ -32,6 +32,7 @@ class LinearStream {
     void replaceBuffer(void *buffer, size_t bufferSize);
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
+    uint64_t getBufferGeneration() const { return bufferGeneration; }
 
     template <typename Cmd>
     Cmd *getSpaceForCmd() {
@@ -40,10 +41,14 @@ class LinearStream {
     }
 
   protected:
+    static uint64_t acquireBufferGeneration();
+
     std::atomic<size_t> sizeUsed;
     size_t maxAvailableSpace;
     void *buffer;
     GraphicsAllocation *graphicsAllocation;
+    // Unique per buffer assignment, data written under one generation is never overwritten
+    uint64_t bufferGeneration;
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -78,6 +83,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    bufferGeneration = acquireBufferGeneration();
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
@@ -11,63 +11,261 @@
 #include "core/helpers/file_io.h"
 #include "core/helpers/hash.h"
 #include "core/helpers/hw_info.h"
+#include "core/helpers/string.h"
 #include "core/utilities/debug_settings_reader.h"
+#include "core/utilities/directory.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <ctime>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+std::array<std::mutex, CompilerCache::keyMutexCount> CompilerCache::cacheAccessMtx;
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
-
-    hash.update("----", 4);
-    hash.update(&*input.begin(), input.size());
-    hash.update("----", 4);
-    hash.update(&*options.begin(), options.size());
-    hash.update("----", 4);
-    hash.update(&*internalOptions.begin(), internalOptions.size());
-
-    hash.update("----", 4);
-    hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
-    hash.update("----", 4);
-    hash.update(reinterpret_cast<const char *>(&hwInfo.featureTable), sizeof(hwInfo.featureTable));
-    hash.update("----", 4);
-    hash.update(reinterpret_cast<const char *>(&hwInfo.workaroundTable), sizeof(hwInfo.workaroundTable));
+    Hash128 hash;
+
+    // streaming hash does not depend on update() boundaries, so size of each part is hashed as well
+    auto hashPart = [&hash](const char *data, size_t size) {
+        hash.update("----", 4);
+        hash.update(reinterpret_cast<const char *>(&size), sizeof(size));
+        hash.update(data, size);
+    };
+
+    hashPart(&*input.begin(), input.size());
+    hashPart(&*options.begin(), options.size());
+    hashPart(&*internalOptions.begin(), internalOptions.size());
+
+    hashPart(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
+    hashPart(reinterpret_cast<const char *>(&hwInfo.featureTable), sizeof(hwInfo.featureTable));
+    hashPart(reinterpret_cast<const char *>(&hwInfo.workaroundTable), sizeof(hwInfo.workaroundTable));
 
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
     return stream.str();
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+std::string CompilerCache::getFilePath(const std::string &kernelFileHash) const {
+    return config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+}
+
+std::mutex &CompilerCache::getKeyMutex(const std::string &kernelFileHash) {
+    return cacheAccessMtx[std::hash<std::string>()(kernelFileHash) % keyMutexCount];
+}
+
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+    std::string filePath = getFilePath(kernelFileHash);
+
+    std::stringstream tmpFilePath;
+    tmpFilePath << filePath << "." << std::hex << std::hash<std::thread::id>()(std::this_thread::get_id())
+                << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+    {
+        // write to temporary file first, so concurrent readers never observe partially written binary
+        std::lock_guard<std::mutex> lock(getKeyMutex(kernelFileHash));
+        if (writeDataToFile(tmpFilePath.str().c_str(), pBinary, binarySize) != binarySize) {
+            std::remove(tmpFilePath.str().c_str());
+            return false;
+        }
+        if (0 != std::rename(tmpFilePath.str().c_str(), filePath.c_str())) {
+            // rename does not replace existing file on all platforms
+            std::remove(filePath.c_str());
+            if (0 != std::rename(tmpFilePath.str().c_str(), filePath.c_str())) {
+                std::remove(tmpFilePath.str().c_str());
+                return false;
+            }
+        }
+    }
+
+    storeInMemoryCache(kernelFileHash, pBinary, binarySize);
+
+    if (config.cacheSize != 0u) {
+        std::lock_guard<std::mutex> lock(diskCacheMtx);
+        touchDiskCacheEntry(kernelFileHash, binarySize);
+        evictDiskCacheEntries();
+    }
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+    auto binary = loadFromMemoryCache(kernelFileHash, cachedBinarySize);
+
+    if (binary == nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(getKeyMutex(kernelFileHash));
+            binary = loadDataFromFile(getFilePath(kernelFileHash).c_str(), cachedBinarySize);
+        }
+        if (binary == nullptr) {
+            return nullptr;
+        }
+        storeInMemoryCache(kernelFileHash, binary.get(), cachedBinarySize);
+    }
+
+    if (config.cacheSize != 0u) {
+        std::lock_guard<std::mutex> lock(diskCacheMtx);
+        touchDiskCacheEntry(kernelFileHash, cachedBinarySize);
+    }
+    return binary;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadFromMemoryCache(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (config.memoryCacheSize == 0u) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(memoryCacheMtx);
+    auto it = memoryCacheIndex.find(kernelFileHash);
+    if (it == memoryCacheIndex.end()) {
+        return nullptr;
+    }
+
+    auto &entry = *it->second;
+    memoryCacheLru.splice(memoryCacheLru.end(), memoryCacheLru, it->second);
+
+    // keep the trailing zero added by loadDataFromFile
+    std::unique_ptr<char[]> binary(new char[entry.binarySize + 1]);
+    memcpy_s(binary.get(), entry.binarySize + 1, entry.binary.get(), entry.binarySize + 1);
+    cachedBinarySize = entry.binarySize;
+    return binary;
+}
+
+void CompilerCache::storeInMemoryCache(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (binarySize > config.memoryCacheSize) {
+        return;
+    }
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    std::unique_ptr<char[]> binary(new char[binarySize + 1]);
+    memcpy_s(binary.get(), binarySize + 1, pBinary, binarySize);
+    binary[binarySize] = 0;
+
+    std::lock_guard<std::mutex> lock(memoryCacheMtx);
+    auto it = memoryCacheIndex.find(kernelFileHash);
+    if (it != memoryCacheIndex.end()) {
+        memoryCacheUsedSize -= it->second->binarySize;
+        memoryCacheLru.erase(it->second);
+        memoryCacheIndex.erase(it);
+    }
+
+    memoryCacheLru.push_back(MemoryCacheEntry{kernelFileHash, std::move(binary), binarySize});
+    memoryCacheIndex[kernelFileHash] = std::prev(memoryCacheLru.end());
+    memoryCacheUsedSize += binarySize;
+
+    while (memoryCacheUsedSize > config.memoryCacheSize) {
+        auto &oldestEntry = memoryCacheLru.front();
+        memoryCacheUsedSize -= oldestEntry.binarySize;
+        memoryCacheIndex.erase(oldestEntry.kernelFileHash);
+        memoryCacheLru.pop_front();
+    }
+}
+
+void CompilerCache::initializeDiskCacheIndex() {
+    if (diskCacheIndexInitialized) {
+        return;
+    }
+    diskCacheIndexInitialized = true;
+
+    struct FileInfo {
+        std::string kernelFileHash;
+        size_t size;
+        time_t lastModified;
+    };
+    std::vector<FileInfo> cachedFiles;
+
+    const auto &extension = config.cacheFileExtension;
+    for (auto &file : Directory::getFiles(config.cacheDir)) {
+        if (file.size() <= extension.size() || 0 != file.compare(file.size() - extension.size(), extension.size(), extension)) {
+            continue;
+        }
+        struct stat fileStat = {};
+        if (0 != stat(file.c_str(), &fileStat)) {
+            continue;
+        }
+        auto nameStart = file.find_last_of("/\\");
+        nameStart = (nameStart == std::string::npos) ? 0 : nameStart + 1;
+        cachedFiles.push_back({file.substr(nameStart, file.size() - extension.size() - nameStart), static_cast<size_t>(fileStat.st_size), fileStat.st_mtime});
+    }
+
+    std::sort(cachedFiles.begin(), cachedFiles.end(), [](const FileInfo &lhs, const FileInfo &rhs) {
+        return lhs.lastModified < rhs.lastModified;
+    });
+    for (auto &cachedFile : cachedFiles) {
+        touchDiskCacheEntry(cachedFile.kernelFileHash, cachedFile.size);
+    }
+}
+
+void CompilerCache::touchDiskCacheEntry(const std::string &kernelFileHash, size_t binarySize) {
+    initializeDiskCacheIndex();
+
+    auto it = diskCacheIndex.find(kernelFileHash);
+    if (it != diskCacheIndex.end()) {
+        diskCacheUsedSize -= it->second->binarySize;
+        it->second->binarySize = binarySize;
+        diskCacheLru.splice(diskCacheLru.end(), diskCacheLru, it->second);
+    } else {
+        diskCacheLru.push_back(DiskCacheEntry{kernelFileHash, binarySize});
+        diskCacheIndex[kernelFileHash] = std::prev(diskCacheLru.end());
+    }
+    diskCacheUsedSize += binarySize;
+}
+
+void CompilerCache::removeStaleTemporaryFiles() {
+    // temporary files of stores interrupted before rename are not indexed and would stay on disk forever
+    const std::string temporaryFileInfix = config.cacheFileExtension + ".";
+    const std::string temporaryFileExtension = ".tmp";
+    auto now = time(nullptr);
+    for (auto &file : Directory::getFiles(config.cacheDir)) {
+        if (file.size() <= temporaryFileExtension.size() ||
+            0 != file.compare(file.size() - temporaryFileExtension.size(), temporaryFileExtension.size(), temporaryFileExtension) ||
+            file.find(temporaryFileInfix) == std::string::npos) {
+            continue;
+        }
+        struct stat fileStat = {};
+        if (0 == stat(file.c_str(), &fileStat) && now - fileStat.st_mtime >= staleTemporaryFileAgeInSeconds) {
+            std::remove(file.c_str());
+        }
+    }
+}
+
+void CompilerCache::evictDiskCacheEntries() {
+    if (diskCacheUsedSize <= config.cacheSize) {
+        return;
+    }
+    removeStaleTemporaryFiles();
+
+    // most recently used entry is never evicted, even if it alone exceeds the limit
+    while (diskCacheUsedSize > config.cacheSize && diskCacheLru.size() > 1) {
+        auto &oldestEntry = diskCacheLru.front();
+        {
+            std::lock_guard<std::mutex> lock(getKeyMutex(oldestEntry.kernelFileHash));
+            std::remove(getFilePath(oldestEntry.kernelFileHash).c_str());
+        }
+        diskCacheUsedSize -= oldestEntry.binarySize;
+        diskCacheIndex.erase(oldestEntry.kernelFileHash);
+        diskCacheLru.pop_front();
+    }
 }
 
 } // namespace NEO
@@ -9,11 +9,14 @@
 
 #include "core/utilities/arrayref.h"
 
+#include <array>
 #include <cstdint>
 #include <cstring>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 struct HardwareInfo;
@@ -22,6 +25,8 @@ struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    size_t cacheSize = 0u;       // bytes kept on disk, 0 - unbounded
+    size_t memoryCacheSize = 0u; // bytes kept in process memory, 0 - memory tier disabled
 };
 
 class CompilerCache {
@@ -40,8 +45,46 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
 
+    size_t peekMemoryCacheUsedSize() const { return memoryCacheUsedSize; }
+    size_t peekDiskCacheUsedSize() const { return diskCacheUsedSize; }
+
   protected:
-    static std::mutex cacheAccessMtx;
+    struct MemoryCacheEntry {
+        std::string kernelFileHash;
+        std::unique_ptr<char[]> binary;
+        size_t binarySize;
+    };
+    struct DiskCacheEntry {
+        std::string kernelFileHash;
+        size_t binarySize;
+    };
+
+    std::string getFilePath(const std::string &kernelFileHash) const;
+    std::mutex &getKeyMutex(const std::string &kernelFileHash);
+
+    std::unique_ptr<char[]> loadFromMemoryCache(const std::string &kernelFileHash, size_t &cachedBinarySize);
+    void storeInMemoryCache(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+
+    void initializeDiskCacheIndex();
+    void touchDiskCacheEntry(const std::string &kernelFileHash, size_t binarySize);
+    void evictDiskCacheEntries();
+    void removeStaleTemporaryFiles();
+
+    static constexpr size_t keyMutexCount = 16u;
+    static std::array<std::mutex, keyMutexCount> cacheAccessMtx;
     CompilerCacheConfig config;
+
+    std::mutex memoryCacheMtx;
+    std::list<MemoryCacheEntry> memoryCacheLru;
+    std::unordered_map<std::string, std::list<MemoryCacheEntry>::iterator> memoryCacheIndex;
+    size_t memoryCacheUsedSize = 0u;
+
+    // temporary files older than this are leftovers of interrupted stores
+    int64_t staleTemporaryFileAgeInSeconds = 60;
+    std::mutex diskCacheMtx;
+    std::list<DiskCacheEntry> diskCacheLru;
+    std::unordered_map<std::string, std::list<DiskCacheEntry>::iterator> diskCacheIndex;
+    size_t diskCacheUsedSize = 0u;
+    bool diskCacheIndexInitialized = false;
 };
 } // namespace NEO
@@ -74,6 +74,8 @@ DECLARE_DEBUG_VARIABLE(bool, PrintEMDebugInformation, false, "prints execution m
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver choosen local workgroup sizes")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch paramters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
+DECLARE_DEBUG_VARIABLE(bool, PrintPlatformInitializationTimes, false, "prints time spent in stages of Platform::initialize")
+DECLARE_DEBUG_VARIABLE(std::string, PlatformInitializationTimesFile, std::string("unk"), "When different value than \"unk\", platform initialization times are written to this file in JSON format")
 DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagnostics messages to standard output, value corresponds to hint level")
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNullHardware, false, "works on Windows only, sets the Null Hardware flag that makes all Command buffers completed while GPU does nothing")
@@ -90,6 +92,11 @@ DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active a
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrTracking, -1, "Enable host ptr tracking: -1 - default platform setting, 0 - disabled, 1 - enabled")
 DECLARE_DEBUG_VARIABLE(bool, DisableDcFlushInEpilogue, false, "Disable DC flush in epilogue")
+DECLARE_DEBUG_VARIABLE(int32_t, ReusableAllocationsBudgetInKB, 262144, "-1: no limit, >=0: size of allocations kept for reuse per command stream receiver, least recently stored completed allocations are released above it")
+DECLARE_DEBUG_VARIABLE(int32_t, HostPtrAllocationCacheBudgetInKB, 0, "0: disabled, >0: size of host pointer allocations kept for reuse between transfers per command stream receiver, application must call clReleaseHostPtrAllocationsINTEL before freeing cached host memory")
+DECLARE_DEBUG_VARIABLE(bool, EnableImmediateFillPattern, true, "Pass fill patterns of up to 16 bytes to fill builtins by value instead of through a pattern allocation")
+DECLARE_DEBUG_VARIABLE(bool, EnableDeferredAuxTranslation, true, "Keep buffers in non-aux state between stateless kernels on in-order queues, translating back to aux lazily")
+DECLARE_DEBUG_VARIABLE(bool, EnableObjectPooling, true, "Allocate events, flush stamps and blocked commands from per-context object pools")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
@@ -125,8 +132,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleep, -1, "-1: dont overr
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideQuickKmdSleepDelayMicroseconds, -1, "-1: dont override, 0: infinite timeout, >0: timeout in microseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideEnableQuickKmdSleepForSporadicWaits, -1, "-1: dont override, 0: disable, 1: enable. It works only when QuickKmdSleep is enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDelayQuickKmdSleepForSporadicWaitsMicroseconds, -1, "-1: dont override, >0: timeout in microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideCompletionWaitMode, -1, "-1: dont override (spin with yield), 0: spin with yield until completion or timeout, 1: adaptive spin, pause backoff and sleep")
 DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whenever driver waits on GPU and its not ready, put waiting thread to sleep and wait for notification.")
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncEventsHandlerCallbackThreads, 0, "0: default - dispatch event callbacks on async events handler thread, >0: number of additional worker threads dispatching completed event callbacks")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferredDeleterWorkersCount, 1, "Number of deferred deleter worker threads, deletions of large allocations are applied first")
+DECLARE_DEBUG_VARIABLE(bool, ParallelDeviceInitialization, false, "Creates root devices and engine allocations concurrently during platform initialization")
+DECLARE_DEBUG_VARIABLE(bool, LazyEngineInitialization, false, "Creates non default engines on first use instead of during device creation, SIP kernel is built on first use")
+DECLARE_DEBUG_VARIABLE(bool, EnableKernelDispatchTemplates, false, "Reuses local ids, interface descriptor and surface states recorded on previous enqueue of the same kernel")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDefaultFP64Settings, -1, "-1: dont override, 0: disable, 1: enable.")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedBuffersEnabled, -1, "-1: default, 0: disabled, 1: enabled")
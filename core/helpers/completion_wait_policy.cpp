@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/helpers/completion_wait_policy.h"
+
+#include "core/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <immintrin.h>
+#include <limits>
+#include <thread>
+
+namespace NEO {
+
+CompletionWaitPolicy::CompletionWaitPolicy() {
+    if (DebugManager.flags.OverrideCompletionWaitMode.get() != -1) {
+        mode = static_cast<Mode>(DebugManager.flags.OverrideCompletionWaitMode.get());
+    }
+}
+
+bool CompletionWaitPolicy::waitForCompletion(volatile uint32_t *tagAddress, uint32_t taskCountToWait, bool enableTimeout, int64_t timeoutMicroseconds) {
+    if (*tagAddress >= taskCountToWait) {
+        return true;
+    }
+    statistics.waits++;
+
+    if (mode == Mode::Spin) {
+        return spinWait(tagAddress, taskCountToWait, enableTimeout, timeoutMicroseconds);
+    }
+
+    auto remainingTime = [&](int64_t elapsed) {
+        return enableTimeout ? std::max<int64_t>(1, timeoutMicroseconds - elapsed + 1) : std::numeric_limits<int64_t>::max();
+    };
+
+    auto expectedTime = expectedCompletionTimeUs.load();
+    int64_t sleepAheadTime = 0;
+    if (expectedTime > CompletionWaitConstants::sleepAheadThresholdMicroseconds) {
+        sleepAheadTime = expectedTime - CompletionWaitConstants::spinWindowMicroseconds - CompletionWaitConstants::backoffWindowMicroseconds;
+    }
+    const int64_t spinEnd = sleepAheadTime + CompletionWaitConstants::spinWindowMicroseconds;
+    const int64_t backoffEnd = spinEnd + CompletionWaitConstants::backoffWindowMicroseconds;
+
+    uint64_t spinIterations = 0;
+    uint64_t backoffIterations = 0;
+    uint64_t sleeps = 0;
+    uint32_t pausesCount = 1;
+    int64_t sleepTime = CompletionWaitConstants::minSleepMicroseconds;
+
+    auto start = getTimeMicroseconds();
+    int64_t elapsed = 0;
+    int64_t lastNotReady = 0;
+    bool completed = false;
+
+    while (true) {
+        if (elapsed < sleepAheadTime) {
+            sleep(std::min({sleepAheadTime - elapsed, CompletionWaitConstants::maxSleepMicroseconds, remainingTime(elapsed)}));
+            sleeps++;
+        } else if (elapsed < spinEnd) {
+            for (uint32_t i = 0; i < CompletionWaitConstants::iterationsBetweenClockReads && *tagAddress < taskCountToWait; i++) {
+                _mm_pause();
+                spinIterations++;
+            }
+        } else if (elapsed < backoffEnd) {
+            for (uint32_t i = 0; i < pausesCount; i++) {
+                _mm_pause();
+            }
+            pausesCount = std::min(pausesCount * 2, CompletionWaitConstants::maxPausesPerBackoffIteration);
+            std::this_thread::yield();
+            backoffIterations++;
+        } else {
+            sleep(std::min(sleepTime, remainingTime(elapsed)));
+            sleepTime = std::min(sleepTime * 2, CompletionWaitConstants::maxSleepMicroseconds);
+            sleeps++;
+        }
+
+        completed = *tagAddress >= taskCountToWait;
+        elapsed = getTimeMicroseconds() - start;
+        if (completed || (enableTimeout && elapsed > timeoutMicroseconds)) {
+            break;
+        }
+        lastNotReady = elapsed;
+    }
+
+    statistics.spinIterations += spinIterations;
+    statistics.backoffIterations += backoffIterations;
+    statistics.sleeps += sleeps;
+    if (completed) {
+        statistics.wakeupLatencyMicroseconds += static_cast<uint64_t>(elapsed - lastNotReady);
+        updateExpectedCompletionTime(elapsed);
+    } else {
+        statistics.timeouts++;
+    }
+    return completed;
+}
+
+bool CompletionWaitPolicy::spinWait(volatile uint32_t *tagAddress, uint32_t taskCountToWait, bool enableTimeout, int64_t timeoutMicroseconds) {
+    auto start = getTimeMicroseconds();
+    int64_t timeDiff = 0;
+    uint64_t spinIterations = 0;
+    while (*tagAddress < taskCountToWait && timeDiff <= timeoutMicroseconds) {
+        std::this_thread::yield();
+        _mm_pause();
+        spinIterations++;
+
+        if (enableTimeout) {
+            timeDiff = getTimeMicroseconds() - start;
+        }
+    }
+    statistics.spinIterations += spinIterations;
+    if (*tagAddress >= taskCountToWait) {
+        return true;
+    }
+    statistics.timeouts++;
+    return false;
+}
+
+void CompletionWaitPolicy::updateExpectedCompletionTime(int64_t observedMicroseconds) {
+    // moving average, concurrent waiters may drop each other's samples which is acceptable for a heuristic
+    auto expectedTime = expectedCompletionTimeUs.load();
+    if (expectedTime == 0) {
+        expectedCompletionTimeUs.store(observedMicroseconds);
+    } else {
+        expectedCompletionTimeUs.store((expectedTime * 7 + observedMicroseconds) / 8);
+    }
+}
+
+void CompletionWaitPolicy::sleep(int64_t microseconds) {
+    std::this_thread::sleep_for(std::chrono::microseconds(microseconds));
+}
+
+int64_t CompletionWaitPolicy::getTimeMicroseconds() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+} // namespace NEO
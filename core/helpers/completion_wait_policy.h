@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+namespace NEO {
+namespace CompletionWaitConstants {
+// time spent busy polling with pause before backing off
+constexpr int64_t spinWindowMicroseconds = 50;
+// time spent polling with growing pause counts and yielding before going to sleep
+constexpr int64_t backoffWindowMicroseconds = 200;
+constexpr uint32_t maxPausesPerBackoffIteration = 64;
+constexpr int64_t minSleepMicroseconds = 10;
+constexpr int64_t maxSleepMicroseconds = 500;
+// waits expected to take longer than this sleep until shortly before the expected completion
+constexpr int64_t sleepAheadThresholdMicroseconds = 2 * (spinWindowMicroseconds + backoffWindowMicroseconds);
+constexpr uint32_t iterationsBetweenClockReads = 32;
+} // namespace CompletionWaitConstants
+
+struct CompletionWaitStatistics {
+    std::atomic<uint64_t> waits{0};
+    std::atomic<uint64_t> spinIterations{0};
+    std::atomic<uint64_t> backoffIterations{0};
+    std::atomic<uint64_t> sleeps{0};
+    std::atomic<uint64_t> timeouts{0};
+    // time between the last observed not-ready tag and the completed one, summed over all waits
+    std::atomic<uint64_t> wakeupLatencyMicroseconds{0};
+};
+
+// Waits for a tag written by GPU. By default spins with yield, same as CSR always did.
+// Adaptive mode (OverrideCompletionWaitMode=1) escalates spin -> pause backoff -> sleep and learns the expected completion latency from past waits, so long waits go to sleep early
+// and short ones never leave the spin phase. KMD wait is left to the caller once timeout expires.
+class CompletionWaitPolicy {
+  public:
+    enum class Mode : int32_t {
+        Spin = 0,
+        Adaptive = 1
+    };
+
+    CompletionWaitPolicy();
+    MOCKABLE_VIRTUAL ~CompletionWaitPolicy() = default;
+
+    bool waitForCompletion(volatile uint32_t *tagAddress, uint32_t taskCountToWait, bool enableTimeout, int64_t timeoutMicroseconds);
+
+    int64_t getExpectedCompletionTimeMicroseconds() const { return expectedCompletionTimeUs.load(); }
+    const CompletionWaitStatistics &peekStatistics() const { return statistics; }
+    Mode getMode() const { return mode; }
+
+  protected:
+    bool spinWait(volatile uint32_t *tagAddress, uint32_t taskCountToWait, bool enableTimeout, int64_t timeoutMicroseconds);
+    void updateExpectedCompletionTime(int64_t observedMicroseconds);
+    MOCKABLE_VIRTUAL void sleep(int64_t microseconds);
+    MOCKABLE_VIRTUAL int64_t getTimeMicroseconds();
+
+    CompletionWaitStatistics statistics;
+    std::atomic<int64_t> expectedCompletionTimeUs{0};
+    Mode mode = Mode::Spin;
+};
+} // namespace NEO
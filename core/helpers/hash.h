@@ -9,7 +9,9 @@
 #include "common/compiler_support.h"
 #include "core/helpers/aligned_memory.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 // clang-format off
@@ -106,6 +108,183 @@ class Hash {
     uint32_t a, hi, lo;
 };
 
+struct HashValue128 {
+    uint64_t low;
+    uint64_t high;
+
+    bool operator==(const HashValue128 &rhs) const { return low == rhs.low && high == rhs.high; }
+    bool operator!=(const HashValue128 &rhs) const { return !(*this == rhs); }
+};
+
+// Streaming 128-bit hash modeled after XXH3-128. Input is consumed in 64-byte stripes by eight
+// accumulators that exchange data between neighbouring lanes and are periodically scrambled.
+// Both 64-bit halves of the result fold all accumulators with 64x64->128-bit multiplies.
+// Unlike Hash, result does not depend on how input is split between update() calls.
+class Hash128 {
+  public:
+    Hash128() {
+        reset();
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr) {
+            return;
+        }
+        auto data = reinterpret_cast<const uint8_t *>(buff);
+        totalSize += size;
+
+        if (pendingSize > 0) {
+            auto bytesToCopy = std::min(stripeSize - pendingSize, size);
+            memcpy(pending + pendingSize, data, bytesToCopy);
+            pendingSize += bytesToCopy;
+            data += bytesToCopy;
+            size -= bytesToCopy;
+            if (pendingSize < stripeSize) {
+                return;
+            }
+            consumeStripe(pending);
+            pendingSize = 0;
+        }
+
+        while (size >= stripeSize) {
+            consumeStripe(data);
+            data += stripeSize;
+            size -= stripeSize;
+        }
+
+        if (size > 0) {
+            memcpy(pending, data, size);
+            pendingSize = size;
+        }
+    }
+
+    HashValue128 finish() const {
+        uint64_t acc[laneCount];
+        memcpy(acc, lanes, sizeof(acc));
+
+        uint8_t lastStripe[stripeSize] = {};
+        memcpy(lastStripe, pending, pendingSize);
+        accumulate(acc, lastStripe, lastStripeSecretOffset);
+
+        HashValue128 value;
+        value.low = mergeAccumulators(acc, lowSecretOffset, totalSize * prime64_1);
+        value.high = mergeAccumulators(acc, highSecretOffset, ~(totalSize * prime64_2));
+        return value;
+    }
+
+    void reset() {
+        lanes[0] = prime32_3;
+        lanes[1] = prime64_1;
+        lanes[2] = prime64_2;
+        lanes[3] = prime64_3;
+        lanes[4] = prime64_4;
+        lanes[5] = prime32_2;
+        lanes[6] = prime64_5;
+        lanes[7] = prime32_1;
+        pendingSize = 0;
+        stripesInBlock = 0;
+        totalSize = 0;
+    }
+
+    static HashValue128 hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static constexpr uint64_t prime32_1 = 0x9e3779b1ull;
+    static constexpr uint64_t prime32_2 = 0x85ebca77ull;
+    static constexpr uint64_t prime32_3 = 0xc2b2ae3dull;
+    static constexpr uint64_t prime64_1 = 0x9e3779b185ebca87ull;
+    static constexpr uint64_t prime64_2 = 0xc2b2ae3d27d4eb4full;
+    static constexpr uint64_t prime64_3 = 0x165667b19e3779f9ull;
+    static constexpr uint64_t prime64_4 = 0x85ebca77c2b2ae63ull;
+    static constexpr uint64_t prime64_5 = 0x27d4eb2f165667c5ull;
+    static constexpr size_t laneCount = 8;
+    static constexpr size_t stripeSize = laneCount * sizeof(uint64_t);
+    static constexpr size_t stripesPerBlock = 16;
+    static constexpr size_t secretCount = 16;
+    static constexpr size_t scrambleSecretOffset = 8;
+    static constexpr size_t lastStripeSecretOffset = 3;
+    static constexpr size_t lowSecretOffset = 1;
+    static constexpr size_t highSecretOffset = 7;
+
+    static uint64_t secret(size_t index) {
+        static constexpr uint64_t values[secretCount] = {
+            0x428a2f98d728ae22ull, 0x7137449123ef65cdull, 0xb5c0fbcfec4d3b2full, 0xe9b5dba58189dbbcull,
+            0x3956c25bf348b538ull, 0x59f111f1b605d019ull, 0x923f82a4af194f9bull, 0xab1c5ed5da6d8118ull,
+            0xd807aa98a3030242ull, 0x12835b0145706fbeull, 0x243185be4ee4b28cull, 0x550c7dc3d5ffb4e2ull,
+            0x72be5d74f27b896full, 0x80deb1fe3b1696b1ull, 0x9bdc06a725c71235ull, 0xc19bf174cf692694ull};
+        return values[index % secretCount];
+    }
+
+    static uint64_t read64(const uint8_t *data) {
+        uint64_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    // Folds the full 128-bit product of lhs and rhs into 64 bits
+    static uint64_t multiplyFold64(uint64_t lhs, uint64_t rhs) {
+        const uint64_t mask32 = 0xffffffffull;
+        uint64_t lowLow = (lhs & mask32) * (rhs & mask32);
+        uint64_t highLow = (lhs >> 32) * (rhs & mask32);
+        uint64_t lowHigh = (lhs & mask32) * (rhs >> 32);
+        uint64_t highHigh = (lhs >> 32) * (rhs >> 32);
+        uint64_t cross = (lowLow >> 32) + (highLow & mask32) + lowHigh;
+        uint64_t upper = (highLow >> 32) + (cross >> 32) + highHigh;
+        uint64_t lower = (cross << 32) | (lowLow & mask32);
+        return lower ^ upper;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 37;
+        value *= 0x165667919e3779f9ull;
+        value ^= value >> 32;
+        return value;
+    }
+
+    static void accumulate(uint64_t *acc, const uint8_t *stripe, size_t secretOffset) {
+        for (size_t lane = 0; lane < laneCount; lane++) {
+            uint64_t dataValue = read64(stripe + lane * sizeof(uint64_t));
+            uint64_t dataKey = dataValue ^ secret(lane + secretOffset);
+            acc[lane ^ 1] += dataValue;
+            acc[lane] += (dataKey & 0xffffffffull) * (dataKey >> 32);
+        }
+    }
+
+    static void scramble(uint64_t *acc) {
+        for (size_t lane = 0; lane < laneCount; lane++) {
+            acc[lane] ^= acc[lane] >> 47;
+            acc[lane] ^= secret(lane + scrambleSecretOffset);
+            acc[lane] *= prime32_1;
+        }
+    }
+
+    static uint64_t mergeAccumulators(const uint64_t *acc, size_t secretOffset, uint64_t start) {
+        uint64_t result = start;
+        for (size_t lane = 0; lane < laneCount; lane += 2) {
+            result += multiplyFold64(acc[lane] ^ secret(lane + secretOffset), acc[lane + 1] ^ secret(lane + 1 + secretOffset));
+        }
+        return avalanche(result);
+    }
+
+    void consumeStripe(const uint8_t *stripe) {
+        accumulate(lanes, stripe, 0);
+        if (++stripesInBlock == stripesPerBlock) {
+            scramble(lanes);
+            stripesInBlock = 0;
+        }
+    }
+
+    uint64_t lanes[laneCount];
+    uint8_t pending[stripeSize];
+    size_t pendingSize;
+    size_t stripesInBlock;
+    uint64_t totalSize;
+};
+
 template <typename T>
 uint32_t hashPtrToU32(const T *src) {
     auto asInt = reinterpret_cast<uintptr_t>(src);
@@ -60,6 +60,10 @@ class GfxPartition {
         return getHeapBase(heapIndex) + heapGranularity;
     }
 
+    HeapFragmentation getHeapFragmentation(HeapIndex heapIndex) {
+        return getHeap(heapIndex).getFragmentation();
+    }
+
     bool isLimitedRange() { return getHeap(HeapIndex::HEAP_SVM).getSize() == 0ull; }
 
     static const uint64_t heapGranularity = MemoryConstants::pageSize64k;
@@ -79,6 +83,7 @@ class GfxPartition {
         uint64_t getLimit() const { return base + size - 1; }
         uint64_t allocate(size_t &size) { return alloc->allocate(size); }
         void free(uint64_t ptr, size_t size) { alloc->free(ptr, size); }
+        HeapFragmentation getFragmentation() { return alloc ? alloc->getFragmentation() : HeapFragmentation{}; }
 
       protected:
         uint64_t base = 0, size = 0;
@@ -8,9 +8,11 @@
 #include "core/compiler_interface/compiler_cache.h"
 #include "core/compiler_interface/compiler_interface.h"
 #include "core/helpers/aligned_memory.h"
+#include "core/helpers/file_io.h"
 #include "core/helpers/hash.h"
 #include "core/helpers/hw_info.h"
 #include "core/helpers/string.h"
+#include "core/utilities/directory.h"
 #include "runtime/compiler_interface/default_cl_cache_config.h"
 #include "test.h"
 #include "unit_tests/fixtures/device_fixture.h"
@@ -18,7 +20,10 @@
 #include "unit_tests/mocks/mock_context.h"
 #include "unit_tests/mocks/mock_program.h"
 
+#include "os_inc.h"
+
 #include <array>
+#include <cstdio>
 #include <list>
 #include <memory>
 
@@ -140,6 +145,20 @@ TEST(CompilerCacheHashTests, hashShortBuffers) {
     }
 }
 
+TEST(CompilerCacheHashTests, givenSameBytesSplitDifferentlyBetweenSourceAndOptionsWhenGettingCachedFileNameThenNamesAreDifferent) {
+    HardwareInfo hwInfo;
+    const char src1[] = "x----y";
+    const char src2[] = "x";
+    const char options2[] = "y----";
+
+    auto hash1 = CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(src1, strlen(src1)), ArrayRef<const char>(), ArrayRef<const char>());
+    auto hash2 = CompilerCache::getCachedFileName(hwInfo, ArrayRef<const char>(src2, strlen(src2)), ArrayRef<const char>(options2, strlen(options2)), ArrayRef<const char>());
+
+    EXPECT_EQ(32u, hash1.size());
+    EXPECT_EQ(32u, hash2.size());
+    EXPECT_NE(hash1, hash2);
+}
+
 TEST(CompilerCacheHashTests, testUnique) {
     static const size_t bufSize = 64;
     HardwareInfo hwInfo;
@@ -253,6 +272,137 @@ TEST(CompilerCacheTests, cacheThenLoad) {
     EXPECT_NE(0U, size);
 }
 
+TEST(CompilerCacheTests, givenMemoryCacheEnabledWhenCachedFileIsRemovedThenBinaryIsLoadedFromMemory) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".memory_tier_test";
+    config.memoryCacheSize = 1024u;
+    CompilerCache cache(config);
+
+    const char binary[] = "binary data";
+    EXPECT_TRUE(cache.cacheBinary("memory_tier_hash", binary, sizeof(binary)));
+    EXPECT_EQ(sizeof(binary), cache.peekMemoryCacheUsedSize());
+
+    std::string filePath = config.cacheDir + PATH_SEPARATOR + "memory_tier_hash" + config.cacheFileExtension;
+    EXPECT_EQ(0, std::remove(filePath.c_str()));
+
+    size_t size = 0;
+    auto loadedBin = cache.loadCachedBinary("memory_tier_hash", size);
+    ASSERT_NE(nullptr, loadedBin);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBin.get(), size));
+}
+
+TEST(CompilerCacheTests, givenMemoryCacheLimitWhenMoreBinariesAreCachedThenLeastRecentlyUsedAreDroppedFromMemory) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".memory_lru_test";
+    config.memoryCacheSize = 64u;
+    CompilerCache cache(config);
+
+    char binary[32] = {};
+    EXPECT_TRUE(cache.cacheBinary("memory_lru_hash0", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("memory_lru_hash1", binary, sizeof(binary)));
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("memory_lru_hash0", size));
+
+    EXPECT_TRUE(cache.cacheBinary("memory_lru_hash2", binary, sizeof(binary)));
+    EXPECT_EQ(64u, cache.peekMemoryCacheUsedSize());
+
+    for (auto hash : {"memory_lru_hash0", "memory_lru_hash1", "memory_lru_hash2"}) {
+        std::string filePath = config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension;
+        std::remove(filePath.c_str());
+    }
+
+    EXPECT_NE(nullptr, cache.loadCachedBinary("memory_lru_hash0", size));
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("memory_lru_hash1", size));
+    EXPECT_NE(nullptr, cache.loadCachedBinary("memory_lru_hash2", size));
+}
+
+TEST(CompilerCacheTests, givenDiskCacheLimitWhenMoreBinariesAreCachedThenLeastRecentlyUsedFilesAreRemoved) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".disk_lru_test";
+    config.cacheSize = 64u;
+    CompilerCache cache(config);
+
+    auto getFilePath = [&](const std::string &hash) {
+        return config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension;
+    };
+
+    char binary[32] = {};
+    EXPECT_TRUE(cache.cacheBinary("disk_lru_hash0", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("disk_lru_hash1", binary, sizeof(binary)));
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("disk_lru_hash0", size));
+
+    EXPECT_TRUE(cache.cacheBinary("disk_lru_hash2", binary, sizeof(binary)));
+    EXPECT_EQ(64u, cache.peekDiskCacheUsedSize());
+
+    EXPECT_TRUE(fileExists(getFilePath("disk_lru_hash0")));
+    EXPECT_FALSE(fileExists(getFilePath("disk_lru_hash1")));
+    EXPECT_TRUE(fileExists(getFilePath("disk_lru_hash2")));
+
+    for (auto &file : Directory::getFiles(config.cacheDir)) {
+        EXPECT_EQ(std::string::npos, file.find(".tmp"));
+    }
+
+    std::remove(getFilePath("disk_lru_hash0").c_str());
+    std::remove(getFilePath("disk_lru_hash2").c_str());
+}
+
+TEST(CompilerCacheTests, givenLeftoverTemporaryFilesWhenDiskCacheEvictsThenStaleTemporaryFilesOfThisCacheAreRemoved) {
+    struct CompilerCacheWithoutTemporaryFileAge : public CompilerCache {
+        CompilerCacheWithoutTemporaryFileAge(const CompilerCacheConfig &config) : CompilerCache(config) {
+            staleTemporaryFileAgeInSeconds = 0;
+        }
+    };
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".stale_tmp_test";
+    config.cacheSize = 64u;
+    CompilerCacheWithoutTemporaryFileAge cache(config);
+
+    auto getFilePath = [&](const std::string &hash) {
+        return config.cacheDir + PATH_SEPARATOR + hash + config.cacheFileExtension;
+    };
+    std::string staleTemporaryFile = getFilePath("stale_tmp_hash") + ".1a2b.tmp";
+    std::string otherTemporaryFile = config.cacheDir + PATH_SEPARATOR + "stale_tmp_hash.other.tmp";
+    char binary[32] = {};
+    ASSERT_EQ(sizeof(binary), writeDataToFile(staleTemporaryFile.c_str(), binary, sizeof(binary)));
+    ASSERT_EQ(sizeof(binary), writeDataToFile(otherTemporaryFile.c_str(), binary, sizeof(binary)));
+
+    EXPECT_TRUE(cache.cacheBinary("stale_tmp_hash0", binary, sizeof(binary)));
+    EXPECT_TRUE(cache.cacheBinary("stale_tmp_hash1", binary, sizeof(binary)));
+    EXPECT_TRUE(fileExists(staleTemporaryFile));
+
+    EXPECT_TRUE(cache.cacheBinary("stale_tmp_hash2", binary, sizeof(binary)));
+    EXPECT_FALSE(fileExists(staleTemporaryFile));
+    EXPECT_TRUE(fileExists(otherTemporaryFile));
+
+    std::remove(otherTemporaryFile.c_str());
+    std::remove(getFilePath("stale_tmp_hash1").c_str());
+    std::remove(getFilePath("stale_tmp_hash2").c_str());
+}
+
+TEST(CompilerCacheTests, givenBinaryCachedTwiceWhenLoadedThenLatestBinaryIsReturned) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheFileExtension = ".overwrite_test";
+    CompilerCache cache(config);
+
+    const char binary0[] = "first";
+    const char binary1[] = "second";
+    EXPECT_TRUE(cache.cacheBinary("overwrite_hash", binary0, sizeof(binary0)));
+    EXPECT_TRUE(cache.cacheBinary("overwrite_hash", binary1, sizeof(binary1)));
+
+    size_t size = 0;
+    auto loadedBin = cache.loadCachedBinary("overwrite_hash", size);
+    ASSERT_NE(nullptr, loadedBin);
+    EXPECT_EQ(sizeof(binary1), size);
+    EXPECT_STREQ(binary1, loadedBin.get());
+
+    std::string filePath = config.cacheDir + PATH_SEPARATOR + "overwrite_hash" + config.cacheFileExtension;
+    std::remove(filePath.c_str());
+}
+
 TEST(CompilerInterfaceCachedTests, notCachedAndIgcFailed) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/helpers/completion_wait_policy.h"
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "test.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MockCompletionWaitPolicy : public CompletionWaitPolicy {
+    using CompletionWaitPolicy::mode;
+    using CompletionWaitPolicy::updateExpectedCompletionTime;
+
+    MockCompletionWaitPolicy() {
+        mode = Mode::Adaptive;
+    }
+
+    void sleep(int64_t microseconds) override {
+        requestedSleeps.push_back(microseconds);
+        if (tagToWriteOnSleep) {
+            *tagToWriteOnSleep = valueToWriteOnSleep;
+        }
+    }
+
+    int64_t getTimeMicroseconds() override {
+        currentTime += timeStep;
+        return currentTime;
+    }
+
+    std::vector<int64_t> requestedSleeps;
+    int64_t currentTime = 0;
+    int64_t timeStep = 5;
+    volatile uint32_t *tagToWriteOnSleep = nullptr;
+    uint32_t valueToWriteOnSleep = 0;
+};
+
+TEST(CompletionWaitPolicyTest, givenTagAlreadyReachedWhenWaitingThenReturnTrueWithoutCountingWait) {
+    MockCompletionWaitPolicy waitPolicy;
+    volatile uint32_t tag = 5;
+
+    EXPECT_TRUE(waitPolicy.waitForCompletion(&tag, 5, false, 0));
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().waits);
+    EXPECT_EQ(0, waitPolicy.getExpectedCompletionTimeMicroseconds());
+}
+
+TEST(CompletionWaitPolicyTest, givenTagNotReachedWhenTimeoutExpiresThenReturnFalseAndCountTimeout) {
+    MockCompletionWaitPolicy waitPolicy;
+    volatile uint32_t tag = 0;
+
+    EXPECT_FALSE(waitPolicy.waitForCompletion(&tag, 1, true, 1000));
+    EXPECT_EQ(1u, waitPolicy.peekStatistics().waits);
+    EXPECT_EQ(1u, waitPolicy.peekStatistics().timeouts);
+    EXPECT_NE(0u, waitPolicy.peekStatistics().spinIterations);
+    EXPECT_NE(0u, waitPolicy.peekStatistics().backoffIterations);
+    EXPECT_NE(0u, waitPolicy.peekStatistics().sleeps);
+    EXPECT_EQ(0, waitPolicy.getExpectedCompletionTimeMicroseconds());
+    for (auto &sleepTime : waitPolicy.requestedSleeps) {
+        EXPECT_LE(sleepTime, CompletionWaitConstants::maxSleepMicroseconds);
+        EXPECT_LE(1, sleepTime);
+    }
+}
+
+TEST(CompletionWaitPolicyTest, givenTagNotReachedBeforeSpinAndBackoffWindowsPassWhenWaitingThenGoToSleep) {
+    MockCompletionWaitPolicy waitPolicy;
+    volatile uint32_t tag = 0;
+    waitPolicy.tagToWriteOnSleep = &tag;
+    waitPolicy.valueToWriteOnSleep = 1;
+
+    EXPECT_TRUE(waitPolicy.waitForCompletion(&tag, 1, false, 0));
+    ASSERT_EQ(1u, waitPolicy.requestedSleeps.size());
+    EXPECT_EQ(CompletionWaitConstants::minSleepMicroseconds, waitPolicy.requestedSleeps[0]);
+    EXPECT_EQ(1u, waitPolicy.peekStatistics().sleeps);
+    EXPECT_NE(0u, waitPolicy.peekStatistics().spinIterations);
+    EXPECT_NE(0u, waitPolicy.peekStatistics().backoffIterations);
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().timeouts);
+    EXPECT_LE(CompletionWaitConstants::spinWindowMicroseconds + CompletionWaitConstants::backoffWindowMicroseconds,
+              waitPolicy.getExpectedCompletionTimeMicroseconds());
+}
+
+TEST(CompletionWaitPolicyTest, givenLongExpectedCompletionTimeWhenWaitingThenSleepBeforeSpinning) {
+    MockCompletionWaitPolicy waitPolicy;
+    waitPolicy.updateExpectedCompletionTime(10000);
+    volatile uint32_t tag = 0;
+    waitPolicy.tagToWriteOnSleep = &tag;
+    waitPolicy.valueToWriteOnSleep = 1;
+
+    EXPECT_TRUE(waitPolicy.waitForCompletion(&tag, 1, false, 0));
+    ASSERT_EQ(1u, waitPolicy.requestedSleeps.size());
+    EXPECT_EQ(CompletionWaitConstants::maxSleepMicroseconds, waitPolicy.requestedSleeps[0]);
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().spinIterations);
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().backoffIterations);
+}
+
+TEST(CompletionWaitPolicyTest, givenTimeoutShorterThanSleepWhenSleepingThenSleepIsLimitedByRemainingTime) {
+    MockCompletionWaitPolicy waitPolicy;
+    waitPolicy.updateExpectedCompletionTime(10000);
+    volatile uint32_t tag = 0;
+
+    EXPECT_FALSE(waitPolicy.waitForCompletion(&tag, 1, true, 20));
+    ASSERT_LE(1u, waitPolicy.requestedSleeps.size());
+    EXPECT_GE(21, waitPolicy.requestedSleeps[0]);
+}
+
+TEST(CompletionWaitPolicyTest, givenObservedCompletionTimesWhenUpdatingThenMovingAverageIsKept) {
+    MockCompletionWaitPolicy waitPolicy;
+    waitPolicy.updateExpectedCompletionTime(800);
+    EXPECT_EQ(800, waitPolicy.getExpectedCompletionTimeMicroseconds());
+
+    waitPolicy.updateExpectedCompletionTime(0);
+    EXPECT_EQ(700, waitPolicy.getExpectedCompletionTimeMicroseconds());
+
+    waitPolicy.updateExpectedCompletionTime(1500);
+    EXPECT_EQ(800, waitPolicy.getExpectedCompletionTimeMicroseconds());
+}
+
+TEST(CompletionWaitPolicyTest, givenSpinModeWhenTimeoutExpiresThenNeitherBackoffNorSleepIsUsed) {
+    MockCompletionWaitPolicy waitPolicy;
+    waitPolicy.mode = CompletionWaitPolicy::Mode::Spin;
+    volatile uint32_t tag = 0;
+
+    EXPECT_FALSE(waitPolicy.waitForCompletion(&tag, 1, true, 100));
+    EXPECT_EQ(1u, waitPolicy.peekStatistics().timeouts);
+    EXPECT_NE(0u, waitPolicy.peekStatistics().spinIterations);
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().backoffIterations);
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().sleeps);
+    EXPECT_TRUE(waitPolicy.requestedSleeps.empty());
+}
+
+TEST(CompletionWaitPolicyTest, givenOverrideCompletionWaitModeSetWhenPolicyIsCreatedThenModeIsOverriddenAndSpinIsDefault) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(CompletionWaitPolicy::Mode::Spin, CompletionWaitPolicy().getMode());
+
+    DebugManager.flags.OverrideCompletionWaitMode.set(1);
+    EXPECT_EQ(CompletionWaitPolicy::Mode::Adaptive, CompletionWaitPolicy().getMode());
+}
+
+TEST(CompletionWaitPolicyTest, givenTagWrittenByAnotherThreadWhenWaitingInAdaptiveModeThenCompletionIsObservedAndLatencyIsLearned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.OverrideCompletionWaitMode.set(1);
+    CompletionWaitPolicy waitPolicy;
+    volatile uint32_t tag = 0;
+    std::atomic<bool> waitStarted{false};
+
+    std::thread tagWriter([&] {
+        while (!waitStarted) {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        tag = 1;
+    });
+
+    waitStarted = true;
+    EXPECT_TRUE(waitPolicy.waitForCompletion(&tag, 1, false, 0));
+    tagWriter.join();
+
+    EXPECT_EQ(1u, waitPolicy.peekStatistics().waits);
+    EXPECT_EQ(0u, waitPolicy.peekStatistics().timeouts);
+    EXPECT_LE(2000, waitPolicy.getExpectedCompletionTimeMicroseconds());
+}
@@ -9,6 +9,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 using namespace NEO;
 
 TEST(HashTests, givenSamePointersWhenHashIsCalculatedThenSame32BitValuesAreGenerated) {
@@ -34,3 +36,61 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(Hash128Tests, givenInputSplitIntoDifferentChunksWhenHashIsCalculatedThenSameValueIsGenerated) {
+    char data[2100];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<char>(i * 31);
+    }
+    auto expected = Hash128::hash(data, sizeof(data));
+
+    for (size_t chunkSize : {1u, 7u, 63u, 64u, 65u, 128u}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < sizeof(data); offset += chunkSize) {
+            hash.update(data + offset, std::min(chunkSize, sizeof(data) - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenInputAtUnalignedAddressWhenHashIsCalculatedThenSameValueAsForAlignedInputIsGenerated) {
+    alignas(8) char alignedData[72] = {};
+    alignas(8) char unalignedStorage[73] = {};
+    for (size_t i = 0; i < sizeof(alignedData); i++) {
+        alignedData[i] = static_cast<char>(i + 1);
+        unalignedStorage[i + 1] = alignedData[i];
+    }
+
+    EXPECT_EQ(Hash128::hash(alignedData, sizeof(alignedData)), Hash128::hash(unalignedStorage + 1, sizeof(alignedData)));
+}
+
+TEST(Hash128Tests, givenInputsDifferingInSizeOrSingleBitWhenHashIsCalculatedThenBothHalvesOfValuesAreUnique) {
+    std::vector<char> data(256, 0);
+    std::vector<HashValue128> hashes;
+
+    for (size_t size = 0; size <= data.size(); size++) {
+        hashes.push_back(Hash128::hash(data.data(), size));
+    }
+    for (size_t bit = 0; bit < data.size() * 8; bit += 13) {
+        data[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+        hashes.push_back(Hash128::hash(data.data(), data.size()));
+        data[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+    }
+
+    for (size_t i = 0; i < hashes.size(); i++) {
+        for (size_t j = i + 1; j < hashes.size(); j++) {
+            EXPECT_NE(hashes[i].low, hashes[j].low) << i << " " << j;
+            EXPECT_NE(hashes[i].high, hashes[j].high) << i << " " << j;
+        }
+    }
+}
+
+TEST(Hash128Tests, givenHashWhenResetThenItStartsOverWithNewInput) {
+    const char data[] = "compiler cache key";
+    Hash128 hash;
+    hash.update("other input", 11);
+    hash.reset();
+    hash.update(data, sizeof(data));
+
+    EXPECT_EQ(Hash128::hash(data, sizeof(data)), hash.finish());
+}
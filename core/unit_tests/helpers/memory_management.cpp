@@ -79,9 +79,15 @@ static void onDeallocationEvent(void *) {
 
 void (*deleteCallback)(void *) = onDeallocationEvent;
 
+static void onAllocation(size_t) {
+}
+
+void (*allocateCallback)(size_t) = onAllocation;
+
 template <AllocationEvent::EventType typeValid, AllocationEvent::EventType typeFail>
 static void *allocate(size_t size) {
     onAllocationEvent();
+    allocateCallback(size);
 
     if (size > maxAllowedAllocationSize) {
         return nullptr;
@@ -135,6 +141,7 @@ static void *allocate(size_t size) {
 template <AllocationEvent::EventType typeValid, AllocationEvent::EventType typeFail>
 static void *allocate(size_t size, const std::nothrow_t &) {
     onAllocationEvent();
+    allocateCallback(size);
 
     if (size > maxAllowedAllocationSize) {
         return nullptr;
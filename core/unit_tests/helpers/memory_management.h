@@ -74,6 +74,7 @@ extern bool logTraces;
 extern bool detailedAllocationLoggingActive;
 extern bool fastLeakDetectionEnabled;
 extern void (*deleteCallback)(void *);
+extern void (*allocateCallback)(size_t);
 
 constexpr auto nonfailingAllocation = static_cast<size_t>(-1);
 constexpr auto invalidLeakIndex = static_cast<size_t>(-1);
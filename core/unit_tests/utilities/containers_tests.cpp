@@ -628,6 +628,34 @@ TEST(IDList, spliceAndDeleteAllNonThreadSafe) {
     iDListSpliceAndDeleteAll<false>();
 }
 
+template <bool ThreadSafe>
+void iDListSpliceFront() {
+    DummyDNode *nodes[3];
+    DummyDNode *nodes2[sizeof(nodes) / sizeof(nodes[0])];
+    uint32_t destructorCounter = 0;
+    makeList(nodes, &destructorCounter);
+    makeList(nodes2, &destructorCounter);
+    IDList<DummyDNode, ThreadSafe, true, false> list;
+    list.spliceFront(*nodes2[0]);
+    EXPECT_EQ(nodes2[0], list.peekHead());
+    EXPECT_EQ(nodes2[2], list.peekTail());
+
+    list.spliceFront(*nodes[0]);
+    EXPECT_EQ(nodes[0], list.peekHead());
+    EXPECT_EQ(nodes2[2], list.peekTail());
+    EXPECT_EQ(nodes2[0], nodes[2]->next);
+    EXPECT_EQ(nodes[2], nodes2[0]->prev);
+    EXPECT_EQ(nullptr, nodes[0]->prev);
+}
+
+TEST(IDList, spliceFrontThreadSafe) {
+    iDListSpliceFront<true>();
+}
+
+TEST(IDList, spliceFrontNonThreadSafe) {
+    iDListSpliceFront<false>();
+}
+
 template <bool ThreadSafe>
 void iDListTestDetachNodes() {
     IDList<DummyDNode, ThreadSafe, false, false> list;
@@ -29,18 +29,24 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     size_t getThresholdSize() const { return this->sizeThreshold; }
     using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec) {
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &freedChunks) {
         size_t sizeOfFreedChunk;
-        return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk);
+        return HeapAllocator::getFromFreedChunks(size, freedChunks, sizeOfFreedChunk);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &freedChunks) { return HeapAllocator::storeInFreedChunks(ptr, size, freedChunks); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    FreedChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    FreedChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
 
+// freed chunks are ordered by address
+HeapChunk getChunk(const FreedChunks &freedChunks, size_t index) {
+    auto chunk = std::next(freedChunks.begin(), index);
+    return HeapChunk(chunk->first, chunk->second);
+}
+
 TEST(HeapAllocatorTest, DefaultCtorHasThresholdSet) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -81,10 +87,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.insert(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks);
 
@@ -97,15 +103,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.insert(0x100000llu, 4096);
+    freedChunks.insert(0x101000llu, 4096);
+    freedChunks.insert(0x105000llu, 4096);
+    freedChunks.insert(0x104000llu, 4096);
+    freedChunks.insert(0x102000llu, 8192);
+    freedChunks.insert(0x109000llu, 8192);
+    freedChunks.insert(0x107000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -122,21 +128,21 @@ TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.insert(pUpperBound, 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.insert(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
+    freedChunks.insert(pUpperBound, 4 * 4096);
 
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
+    freedChunks.insert(pUpperBound, 5 * 4096);
     pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.insert(pUpperBound, 4 * 4096);
+    ptrExpected = pUpperBound; // lowest address among best fitting chunks
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -153,15 +159,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.insert(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -173,8 +179,8 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    EXPECT_EQ(pLowerBound, getChunk(freedChunks, 2).ptr);
+    EXPECT_EQ(deltaSize, getChunk(freedChunks, 2).size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -184,18 +190,18 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(expectedSize, getChunk(freedChunks, 1).size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -208,8 +214,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(expectedSize, getChunk(freedChunks, 1).size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
@@ -219,11 +225,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -231,11 +237,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(expectedSize, getChunk(freedChunks, 1).size);
 
     EXPECT_EQ(2u, freedChunks.size());
 
@@ -246,8 +252,8 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(ptrExpected, getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(expectedSize, getChunk(freedChunks, 1).size);
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
@@ -257,11 +263,11 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreedChunks freedChunks;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.insert(pLowerBound, 4096);
     pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.insert(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -275,8 +281,43 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_EQ(ptrToStore, getChunk(freedChunks, 2).ptr);
+    EXPECT_EQ(sizeToStore, getChunk(freedChunks, 2).size);
+}
+
+TEST(HeapAllocatorTest, GivenStoredChunksAdjacentToBothBoundariesOfIncomingChunkWhenStoreIsCalledThenAllChunksAreMergedIntoOne) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+
+    FreedChunks freedChunks;
+    freedChunks.insert(ptrBase, 4096);
+    freedChunks.insert(ptrBase + 3 * 4096, 2 * 4096);
+    freedChunks.insert(ptrBase + 10 * 4096, 4096);
+
+    heapAllocator->storeInFreedChunks(ptrBase + 5 * 4096, 5 * 4096, freedChunks);
+
+    ASSERT_EQ(2u, freedChunks.size());
+    EXPECT_EQ(ptrBase, getChunk(freedChunks, 0).ptr);
+    EXPECT_EQ(4096u, getChunk(freedChunks, 0).size);
+    EXPECT_EQ(ptrBase + 3 * 4096, getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(8 * 4096u, getChunk(freedChunks, 1).size);
+}
+
+TEST(HeapAllocatorTest, GivenStoredChunksWhenNotAdjacentChunkIsStoredBetweenThemThenAddressOrderIsKept) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+
+    FreedChunks freedChunks;
+    heapAllocator->storeInFreedChunks(ptrBase + 8 * 4096, 4096, freedChunks);
+    heapAllocator->storeInFreedChunks(ptrBase, 4096, freedChunks);
+    heapAllocator->storeInFreedChunks(ptrBase + 4 * 4096, 4096, freedChunks);
+
+    ASSERT_EQ(3u, freedChunks.size());
+    EXPECT_EQ(ptrBase, getChunk(freedChunks, 0).ptr);
+    EXPECT_EQ(ptrBase + 4 * 4096, getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(ptrBase + 8 * 4096, getChunk(freedChunks, 2).ptr);
 }
 
 TEST(HeapAllocatorTest, AllocateReturnsPointerAndAddsEntryToMap) {
@@ -745,7 +786,7 @@ TEST(HeapAllocatorTest, defragmentBig) {
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -772,21 +813,19 @@ TEST(HeapAllocatorTest, defragmentBig) {
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0,1,2 - merged on free
+    // 6,7,8,10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ(basePtr, getChunk(freedChunks, 0).ptr);
+    EXPECT_EQ(3 * allocSize, getChunk(freedChunks, 0).size);
 
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((basePtr + 6 * allocSize), getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(5 * allocSize, getChunk(freedChunks, 1).size);
 }
 
 TEST(HeapAllocatorTest, defragmentSmall) {
@@ -802,7 +841,7 @@ TEST(HeapAllocatorTest, defragmentSmall) {
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -829,21 +868,19 @@ TEST(HeapAllocatorTest, defragmentSmall) {
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0,1,2 - merged on free
+    // 6,7,8,10 - merged on free
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
+    EXPECT_EQ((upperLimitPtr - 10 * allocSize), getChunk(freedChunks, 0).ptr);
+    EXPECT_EQ(5 * allocSize, getChunk(freedChunks, 0).size);
 
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ((upperLimitPtr - 3 * allocSize), getChunk(freedChunks, 1).ptr);
+    EXPECT_EQ(3 * allocSize, getChunk(freedChunks, 1).size);
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -853,7 +890,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -889,8 +926,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -950,8 +987,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreedChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreedChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -1002,3 +1039,94 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
     EXPECT_EQ(0u, freedChunksSmall.size());
     EXPECT_EQ(0u, freedChunksBig.size());
 }
+
+TEST(HeapAllocatorTest, GivenFreedChunksWhenGettingFragmentationThenFreeSpaceIsReported) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    size_t threshold = 4 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
+
+    auto fragmentation = heapAllocator->getFragmentation();
+    EXPECT_EQ(0u, fragmentation.freedChunksCount);
+    EXPECT_EQ(0u, fragmentation.freedChunksSize);
+    EXPECT_EQ(size, fragmentation.largestFreeBlockSize);
+    EXPECT_EQ(size, fragmentation.availableSize);
+    EXPECT_EQ(0.0, fragmentation.getExternalFragmentation());
+
+    uint64_t ptrs[4];
+    size_t sizes[4] = {4096, 4096, 8 * 4096, 8 * 4096};
+    for (uint32_t i = 0; i < 4; i++) {
+        ptrs[i] = heapAllocator->allocate(sizes[i]);
+        EXPECT_NE(0llu, ptrs[i]);
+    }
+    heapAllocator->free(ptrs[0], sizes[0]);
+    heapAllocator->free(ptrs[2], sizes[2]);
+
+    fragmentation = heapAllocator->getFragmentation();
+    EXPECT_EQ(2u, fragmentation.freedChunksCount);
+    EXPECT_EQ(9 * 4096u, fragmentation.freedChunksSize);
+    EXPECT_EQ(size - 18 * 4096, fragmentation.largestFreeBlockSize);
+    EXPECT_EQ(size - 9 * 4096, fragmentation.availableSize);
+    EXPECT_LT(0.0, fragmentation.getExternalFragmentation());
+
+    heapAllocator->free(ptrs[1], sizes[1]);
+    heapAllocator->free(ptrs[3], sizes[3]);
+
+    fragmentation = heapAllocator->getFragmentation();
+    EXPECT_EQ(0u, fragmentation.freedChunksCount);
+    EXPECT_EQ(size, fragmentation.largestFreeBlockSize);
+}
+
+TEST(HeapAllocatorTest, GivenRandomAllocationsAndFreesWhenCheckingFreedChunksThenTheyAreSortedAndFullyCoalesced) {
+    std::mt19937 generator(7);
+
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 256 * MemoryConstants::megaByte;
+    size_t threshold = 16 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
+
+    auto verifyFreedChunks = [&](FreedChunks &freedChunks, uint64_t &freedSize) {
+        uint64_t previousChunkEnd = 0llu;
+        for (auto &chunk : freedChunks) {
+            freedSize += chunk.second;
+            if (previousChunkEnd != 0llu) {
+                ASSERT_LT(previousChunkEnd, chunk.first);
+            }
+            previousChunkEnd = chunk.first + chunk.second;
+        }
+    };
+
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    for (uint32_t iteration = 0; iteration < 20000; iteration++) {
+        if (allocations.empty() || generator() % 3 != 0) {
+            size_t sizeToAllocate = (1 + generator() % 32) * 4096;
+            auto ptr = heapAllocator->allocate(sizeToAllocate);
+            if (ptr != 0llu) {
+                allocations.emplace_back(ptr, sizeToAllocate);
+            }
+        } else {
+            auto index = generator() % allocations.size();
+            heapAllocator->free(allocations[index].first, allocations[index].second);
+            allocations[index] = allocations.back();
+            allocations.pop_back();
+        }
+
+        if (iteration % 100 == 0) {
+            uint64_t freedSize = 0;
+            verifyFreedChunks(heapAllocator->getFreedChunksSmall(), freedSize);
+            verifyFreedChunks(heapAllocator->getFreedChunksBig(), freedSize);
+            EXPECT_EQ(heapAllocator->getavailableSize(), freedSize + heapAllocator->getRightBound() - heapAllocator->getLeftBound());
+        }
+    }
+
+    std::shuffle(allocations.begin(), allocations.end(), generator);
+    for (auto &allocation : allocations) {
+        heapAllocator->free(allocation.first, allocation.second);
+    }
+
+    EXPECT_EQ(0u, heapAllocator->getFreedChunksSmall().size());
+    EXPECT_EQ(0u, heapAllocator->getFreedChunksBig().size());
+    EXPECT_EQ(ptrBase, heapAllocator->getLeftBound());
+    EXPECT_EQ(ptrBase + size, heapAllocator->getRightBound());
+    EXPECT_EQ(size, heapAllocator->getavailableSize());
+}
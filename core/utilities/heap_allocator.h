@@ -11,6 +11,10 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -24,6 +28,71 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+// Freed chunks indexed by address, to merge an incoming chunk with its neighbours,
+// and by size, to find the best fit for an allocation in O(log n)
+class FreedChunks {
+  public:
+    using AddressMap = std::map<uint64_t, size_t>;
+
+    AddressMap::const_iterator begin() const { return chunksByAddress.begin(); }
+    AddressMap::const_iterator end() const { return chunksByAddress.end(); }
+    AddressMap::const_iterator lowerBound(uint64_t ptr) const { return chunksByAddress.lower_bound(ptr); }
+    size_t size() const { return chunksByAddress.size(); }
+    bool empty() const { return chunksByAddress.empty(); }
+
+    void insert(uint64_t ptr, size_t size) {
+        chunksByAddress.emplace(ptr, size);
+        chunksBySize.emplace(size, ptr);
+    }
+
+    void erase(uint64_t ptr) {
+        auto chunk = chunksByAddress.find(ptr);
+        DEBUG_BREAK_IF(chunk == chunksByAddress.end());
+        chunksBySize.erase(std::make_pair(chunk->second, ptr));
+        chunksByAddress.erase(chunk);
+    }
+
+    void resize(uint64_t ptr, size_t newSize) {
+        auto chunk = chunksByAddress.find(ptr);
+        DEBUG_BREAK_IF(chunk == chunksByAddress.end());
+        chunksBySize.erase(std::make_pair(chunk->second, ptr));
+        chunksBySize.emplace(newSize, ptr);
+        chunk->second = newSize;
+    }
+
+    // smallest chunk not smaller than size, lowest address among chunks of equal size
+    bool findBestFit(size_t size, HeapChunk &bestFit) const {
+        auto chunk = chunksBySize.lower_bound(std::make_pair(size, uint64_t(0)));
+        if (chunk == chunksBySize.end()) {
+            return false;
+        }
+        bestFit = HeapChunk(chunk->second, chunk->first);
+        return true;
+    }
+
+    size_t getLargestChunkSize() const {
+        return chunksBySize.empty() ? 0u : chunksBySize.rbegin()->first;
+    }
+
+  protected:
+    AddressMap chunksByAddress;
+    std::set<std::pair<size_t, uint64_t>> chunksBySize;
+};
+
+struct HeapFragmentation {
+    size_t freedChunksCount = 0;
+    uint64_t freedChunksSize = 0;
+    uint64_t largestFreeBlockSize = 0;
+    uint64_t availableSize = 0;
+
+    double getExternalFragmentation() const {
+        if (availableSize == 0) {
+            return 0.0;
+        }
+        return 1.0 - static_cast<double>(largestFreeBlockSize) / availableSize;
+    }
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, 4 * MemoryConstants::megaByte) {
@@ -32,8 +101,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t threshold) : size(size), availableSize(size), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -45,7 +112,7 @@ class HeapAllocator {
             return 0llu;
         }
 
-        std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+        FreedChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
         uint32_t defragmentCount = 0;
 
         for (;;) {
@@ -118,6 +185,22 @@ class HeapAllocator {
         return static_cast<double>(size - availableSize) / size;
     }
 
+    HeapFragmentation getFragmentation() {
+        std::lock_guard<std::mutex> lock(mtx);
+        HeapFragmentation fragmentation;
+        fragmentation.availableSize = availableSize;
+        fragmentation.largestFreeBlockSize = pRightBound - pLeftBound;
+
+        for (auto freedChunks : {&freedChunksSmall, &freedChunksBig}) {
+            fragmentation.freedChunksCount += freedChunks->size();
+            for (auto &chunk : *freedChunks) {
+                fragmentation.freedChunksSize += chunk.second;
+            }
+            fragmentation.largestFreeBlockSize = std::max(fragmentation.largestFreeBlockSize, static_cast<uint64_t>(freedChunks->getLargestChunkSize()));
+        }
+        return fragmentation;
+    }
+
   protected:
     const uint64_t size;
     uint64_t availableSize;
@@ -126,124 +209,95 @@ class HeapAllocator {
     const size_t sizeThreshold;
     size_t allocationAlignment = MemoryConstants::pageSize;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    FreedChunks freedChunksSmall;
+    FreedChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk) {
-        size_t elements = freedChunks.size();
-        size_t bestFitIndex = -1;
-        size_t bestFitSize = 0;
+    uint64_t getFromFreedChunks(size_t size, FreedChunks &freedChunks, size_t &sizeOfFreedChunk) {
+        HeapChunk bestFit(0llu, 0u);
         sizeOfFreedChunk = 0;
 
-        for (size_t i = 0; i < elements; i++) {
-            if (freedChunks[i].size == size) {
-                auto ptr = freedChunks[i].ptr;
-                freedChunks.erase(freedChunks.begin() + i);
-                return ptr;
-            }
+        if (!freedChunks.findBestFit(size, bestFit)) {
+            return 0llu;
+        }
 
-            if (freedChunks[i].size > size) {
-                if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                    bestFitIndex = i;
-                    bestFitSize = freedChunks[i].size;
-                }
+        if (bestFit.size < (size << 1)) {
+            freedChunks.erase(bestFit.ptr);
+            if (bestFit.size != size) {
+                sizeOfFreedChunk = bestFit.size;
             }
+            return bestFit.ptr;
         }
 
-        if (bestFitSize != 0) {
-            if (bestFitSize < (size << 1)) {
-                auto ptr = freedChunks[bestFitIndex].ptr;
-                sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-                freedChunks.erase(freedChunks.begin() + bestFitIndex);
-                return ptr;
-            } else {
-                size_t sizeDelta = freedChunks[bestFitIndex].size - size;
+        size_t sizeDelta = bestFit.size - size;
 
-                DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
+        DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
 
-                auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-                freedChunks[bestFitIndex].size = sizeDelta;
-                return ptr;
-            }
-        }
-        return 0llu;
+        freedChunks.resize(bestFit.ptr, sizeDelta);
+        return bestFit.ptr + sizeDelta;
     }
 
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
+    void storeInFreedChunks(uint64_t ptr, size_t size, FreedChunks &freedChunks) {
+        // both neighbours of incoming chunk are found in the address index and merged with it right away
+        auto next = freedChunks.lowerBound(ptr);
+
+        if (next != freedChunks.begin()) {
+            auto previous = std::prev(next);
+            if (previous->first + previous->second == ptr) {
+                ptr = previous->first;
+                size += previous->second;
+                freedChunks.erase(ptr);
             }
         }
 
-        freedChunks.emplace_back(ptr, size);
+        if (next != freedChunks.end() && next->first == ptr + size) {
+            size += next->second;
+            freedChunks.erase(next->first);
+        }
+
+        freedChunks.insert(ptr, size);
     }
 
     void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
+        if (!freedChunksSmall.empty()) {
+            auto lowestChunk = freedChunksSmall.begin();
+            if (lowestChunk->first == pRightBound) {
+                pRightBound += lowestChunk->second;
+                freedChunksSmall.erase(lowestChunk->first);
             }
         }
     }
 
     void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
+        if (!freedChunksBig.empty()) {
+            auto highestChunk = std::prev(freedChunksBig.end());
+            if (highestChunk->first + highestChunk->second == pLeftBound) {
+                pLeftBound = highestChunk->first;
+                freedChunksBig.erase(highestChunk->first);
             }
         }
     }
 
     void defragment() {
-
-        if (freedChunksSmall.size() > 1) {
-            std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-            size_t maxSize = freedChunksSmall.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksSmall[i].ptr;
-                size_t chunkSize = freedChunksSmall[i].size;
-
-                if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                    freedChunksSmall[i - 1].ptr = ptr;
-                    freedChunksSmall[i - 1].size += chunkSize;
-                    freedChunksSmall.erase(freedChunksSmall.begin() + i);
-                }
-            }
-        }
+        coalesceFreedChunks(freedChunksSmall);
         mergeLastFreedSmall();
-        if (freedChunksBig.size() > 1) {
-            std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-            size_t maxSize = freedChunksBig.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksBig[i].ptr;
-                size_t chunkSize = freedChunksBig[i].size;
-                if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                    freedChunksBig[i - 1].size += chunkSize;
-                    freedChunksBig.erase(freedChunksBig.begin() + i);
-                }
-            }
-        }
+        coalesceFreedChunks(freedChunksBig);
         mergeLastFreedBig();
         DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
     }
+
+    void coalesceFreedChunks(FreedChunks &freedChunks) {
+        auto chunk = freedChunks.begin();
+        while (chunk != freedChunks.end()) {
+            auto next = std::next(chunk);
+            if (next != freedChunks.end() && chunk->first + chunk->second == next->first) {
+                auto mergedSize = chunk->second + next->second;
+                freedChunks.erase(next->first);
+                freedChunks.resize(chunk->first, mergedSize);
+            } else {
+                chunk = next;
+            }
+        }
+    }
 };
 } // namespace NEO
@@ -225,6 +225,10 @@ class IDList {
         processLocked<ThisType, &ThisType::spliceImpl>(&nodes);
     }
 
+    void spliceFront(NodeObjectType &nodes) {
+        processLocked<ThisType, &ThisType::spliceFrontImpl>(&nodes);
+    }
+
     void deleteAll() {
         NodeObjectType *nodes = detachNodes();
         nodes->deleteThisAndAllNext();
@@ -434,6 +438,19 @@ class IDList {
         return nullptr;
     }
 
+    NodeObjectType *spliceFrontImpl(NodeObjectType *node, void *) {
+        if (head == nullptr) {
+            return spliceImpl(node, nullptr);
+        }
+
+        auto last = node->getTail();
+        last->next = head;
+        head->prev = last;
+        node->prev = nullptr;
+        head = node;
+        return nullptr;
+    }
+
     NodeObjectType *peekContainsImpl(NodeObjectType *node, void *) {
         NodeObjectType *curr = head;
         while (curr != nullptr) {
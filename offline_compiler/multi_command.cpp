@@ -7,37 +7,86 @@
 
 #include "offline_compiler/multi_command.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <thread>
+
 namespace NEO {
-int MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &allArgs) {
+static bool isNumber(const std::string &arg) {
+    return !arg.empty() && arg.size() < 10 && std::all_of(arg.begin(), arg.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+int MultiCommand::singleBuild(size_t buildId) {
+    auto start = std::chrono::steady_clock::now();
+    const auto &args = buildsArguments[buildId];
+    auto &buildOutput = buildOutputs[buildId];
+
     int retVal = CL_SUCCESS;
     std::string buildLog;
-    OfflineCompiler *pCompiler = OfflineCompiler::create(numArgs, allArgs, retVal);
+    // compiler messages go to the per build output, so builds running in parallel do not interleave
+    OfflineCompiler *pCompiler = OfflineCompiler::create(args.size(), args, retVal, &buildOutput);
     if (retVal == CL_SUCCESS) {
         retVal = buildWithSafetyGuard(pCompiler);
 
         buildLog = pCompiler->getBuildLog();
         if (buildLog.empty() == false) {
-            printf("%s\n", buildLog.c_str());
+            buildOutput += buildLog + "\n";
         }
 
         if (retVal == CL_SUCCESS) {
             if (!pCompiler->isQuiet())
-                printf("Build succeeded.\n");
+                buildOutput += "Build succeeded.\n";
         } else {
-            printf("Build failed with error code: %d\n", retVal);
+            buildOutput += "Build failed with error code: " + std::to_string(retVal) + "\n";
         }
     }
     if (buildLog.empty() == false) {
-        singleBuilds.push_back(pCompiler);
+        buildsWithLogs[buildId] = pCompiler;
     } else {
         delete pCompiler;
     }
 
+    auto end = std::chrono::steady_clock::now();
+    buildTimesInMs[buildId] = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    return retVal;
+}
+
+void MultiCommand::runBuildsInParallel() {
+    std::atomic<size_t> nextBuild{0};
+    auto buildWorker = [&]() {
+        for (size_t buildId = nextBuild++; buildId < lines.size(); buildId = nextBuild++) {
+            if (!buildsArguments[buildId].empty()) {
+                retValues[buildId] = singleBuild(buildId);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < parallelBuilds; i++) {
+        workers.emplace_back(buildWorker);
+    }
+    buildWorker();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void MultiCommand::reportBuild(size_t buildId) {
+    if (buildOutputs[buildId].empty() == false) {
+        printf("%s", buildOutputs[buildId].c_str());
+    }
+    if (buildsWithLogs[buildId] != nullptr) {
+        singleBuilds.push_back(buildsWithLogs[buildId]);
+        buildsWithLogs[buildId] = nullptr;
+    }
+
     if (outputFileList != "") {
         std::ofstream myfile(outputFileList, std::fstream::app);
         if (myfile.is_open()) {
-            if (retVal == CL_SUCCESS)
-                myfile << getCurrentDirectoryOwn(outDirForBuilds) + OutFileName + ".bin";
+            if (retValues[buildId] == CL_SUCCESS)
+                myfile << getCurrentDirectoryOwn(outDirForBuilds) + outFileNames[buildId] + ".bin";
             else
                 myfile << "Unsuccesful build";
             myfile << std::endl;
@@ -45,9 +94,8 @@ int MultiCommand::singleBuild(size_t numArgs, const std::vector<std::string> &al
         } else
             printf("Unable to open outputFileList\n");
     }
-
-    return retVal;
 }
+
 MultiCommand::MultiCommand() = default;
 
 MultiCommand::~MultiCommand() {
@@ -58,6 +106,9 @@ void MultiCommand::deleteBuildsWithWarnigs() {
     for (OfflineCompiler *pSingle : singleBuilds)
         delete pSingle;
     singleBuilds.clear();
+    for (OfflineCompiler *pSingle : buildsWithLogs)
+        delete pSingle;
+    buildsWithLogs.clear();
 }
 
 MultiCommand *MultiCommand::create(const std::vector<std::string> &argv, int &retVal) {
@@ -98,6 +149,12 @@ void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::stri
             hasSpecificName = true;
         }
     }
+    if (hasSpecificName) {
+        auto outputArg = std::find(singleLineWithArguments.begin(), singleLineWithArguments.end(), "-output");
+        if (outputArg + 1 != singleLineWithArguments.end()) {
+            outFileNames[buildId] = *(outputArg + 1);
+        }
+    }
     if (!hasOutDir) {
         singleLineWithArguments.push_back("-out_dir");
         outDirForBuilds = eraseExtensionFromPath(pathToCMD);
@@ -105,8 +162,8 @@ void MultiCommand::addAdditionalOptionsToSingleCommandLine(std::vector<std::stri
     }
     if (!hasSpecificName) {
         singleLineWithArguments.push_back("-output");
-        OutFileName = "build_no_" + std::to_string(buildId + 1);
-        singleLineWithArguments.push_back(OutFileName);
+        outFileNames[buildId] = "build_no_" + std::to_string(buildId + 1);
+        singleLineWithArguments.push_back(outFileNames[buildId]);
     }
     if (quiet)
         singleLineWithArguments.push_back("-q");
@@ -135,6 +192,17 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
                 return INVALID_COMMAND_LINE;
             }
             argIndex++;
+        } else if (allArgs[argIndex] == "-parallel") {
+            if (numArgs > argIndex + 1 && isNumber(allArgs[argIndex + 1])) {
+                parallelBuilds = static_cast<uint32_t>(std::stoul(allArgs[argIndex + 1]));
+                if (parallelBuilds == 0u) {
+                    parallelBuilds = std::max(1u, std::thread::hardware_concurrency());
+                }
+            } else {
+                printHelp();
+                return INVALID_COMMAND_LINE;
+            }
+            argIndex++;
         } else if (allArgs[argIndex] == "--help") {
             printHelp();
             return PRINT_USAGE;
@@ -148,26 +216,52 @@ int MultiCommand::initialize(const std::vector<std::string> &allArgs) {
     //save file with builds arguments to vector of strings, line by line
     openFileWithBuildsArguments();
     if (!lines.empty()) {
+        retValues.resize(lines.size(), CL_SUCCESS);
+        buildsArguments.resize(lines.size());
+        outFileNames.resize(lines.size());
+        buildOutputs.resize(lines.size());
+        buildsWithLogs.resize(lines.size(), nullptr);
+        buildTimesInMs.resize(lines.size(), 0);
+
         for (unsigned int i = 0; i < lines.size(); i++) {
             std::vector<std::string> singleLineWithArguments;
-            unsigned int numberOfArg;
 
             singleLineWithArguments.push_back(allArgs[0]);
             retVal = splitLineInSeparateArgs(singleLineWithArguments, lines[i], i);
             if (retVal != CL_SUCCESS) {
-                retValues.push_back(retVal);
+                retValues[i] = retVal;
                 continue;
             }
 
             addAdditionalOptionsToSingleCommandLine(singleLineWithArguments, i);
+            buildsArguments[i] = std::move(singleLineWithArguments);
+        }
 
-            numberOfArg = static_cast<unsigned int>(singleLineWithArguments.size());
-
-            if (!quiet)
-                printf("\nCommand number %d: ", i + 1);
-            retVal = singleBuild(numberOfArg, singleLineWithArguments);
-            retValues.push_back(retVal);
+        auto start = std::chrono::steady_clock::now();
+        if (parallelBuilds > 1u) {
+            // builds run independently, their output is printed in the order of the builds list
+            runBuildsInParallel();
+            for (unsigned int i = 0; i < lines.size(); i++) {
+                if (buildsArguments[i].empty()) {
+                    continue;
+                }
+                if (!quiet)
+                    printf("\nCommand number %d: ", i + 1);
+                reportBuild(i);
+            }
+        } else {
+            for (unsigned int i = 0; i < lines.size(); i++) {
+                if (buildsArguments[i].empty()) {
+                    continue;
+                }
+                if (!quiet)
+                    printf("\nCommand number %d: ", i + 1);
+                retValues[i] = singleBuild(i);
+                reportBuild(i);
+            }
         }
+        auto end = std::chrono::steady_clock::now();
+        wallClockTimeInMs = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
         return showResults();
     } else {
@@ -191,6 +285,11 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -parallel <N>                 Runs up to N builds at the same time.
+                                0 uses one build per hardware thread.
+                                Output of builds is printed in the order
+                                of the input file.
+
 )===");
 }
 
@@ -274,6 +373,13 @@ int MultiCommand::showResults() {
         }
         indexRetVal++;
     }
+    if (!quiet && parallelBuilds > 1u) {
+        long long serialTimeInMs = 0;
+        for (auto buildTime : buildTimesInMs) {
+            serialTimeInMs += buildTime;
+        }
+        printf("Wall-clock time: %lld ms, accumulated build time: %lld ms, parallel builds: %u\n", wallClockTimeInMs, serialTimeInMs, parallelBuilds);
+    }
     return retValue;
 }
 } // namespace NEO
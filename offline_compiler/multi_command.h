@@ -16,6 +16,8 @@
 
 #include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace NEO {
 
@@ -40,14 +42,23 @@ class MultiCommand {
     void printHelp();
     int initialize(const std::vector<std::string> &allArgs);
     int showResults();
-    int singleBuild(size_t numArgs, const std::vector<std::string> &allArgs);
+    int singleBuild(size_t buildId);
+    void runBuildsInParallel();
+    void reportBuild(size_t buildId);
     std::string eraseExtensionFromPath(std::string &filePath);
-    std::string OutFileName;
 
     std::vector<int> retValues;
     std::string pathToCMD;
     std::vector<std::string> lines;
     bool quiet = false;
+    uint32_t parallelBuilds = 1u;
+
+    std::vector<std::vector<std::string>> buildsArguments;
+    std::vector<std::string> outFileNames;
+    std::vector<std::string> buildOutputs;
+    std::vector<OfflineCompiler *> buildsWithLogs;
+    std::vector<long long> buildTimesInMs;
+    long long wallClockTimeInMs = 0;
 
     MultiCommand();
 };
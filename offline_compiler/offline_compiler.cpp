@@ -29,6 +29,7 @@
 #include "ocl_igc_interface/platform_helper.h"
 
 #include <algorithm>
+#include <cstdarg>
 #include <iomanip>
 #include <iostream>
 #include <list>
@@ -70,11 +71,12 @@ OfflineCompiler::~OfflineCompiler() {
     delete[] genBinary;
 }
 
-OfflineCompiler *OfflineCompiler::create(size_t numArgs, const std::vector<std::string> &allArgs, int &retVal) {
+OfflineCompiler *OfflineCompiler::create(size_t numArgs, const std::vector<std::string> &allArgs, int &retVal, std::string *messagesOutput) {
     retVal = CL_SUCCESS;
     auto pOffCompiler = new OfflineCompiler();
 
     if (pOffCompiler) {
+        pOffCompiler->messagesOutput = messagesOutput;
         retVal = pOffCompiler->initialize(numArgs, allArgs);
     }
 
@@ -86,6 +88,26 @@ OfflineCompiler *OfflineCompiler::create(size_t numArgs, const std::vector<std::
     return pOffCompiler;
 }
 
+void OfflineCompiler::printMessage(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    if (messagesOutput == nullptr) {
+        vprintf(format, args);
+    } else {
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        auto messageSize = vsnprintf(nullptr, 0, format, argsCopy);
+        va_end(argsCopy);
+        if (messageSize > 0) {
+            std::string message(static_cast<size_t>(messageSize) + 1, '\0');
+            vsnprintf(&message[0], message.size(), format, args);
+            message.resize(static_cast<size_t>(messageSize));
+            messagesOutput->append(message);
+        }
+    }
+    va_end(args);
+}
+
 int OfflineCompiler::buildSourceCode() {
     int retVal = CL_SUCCESS;
 
@@ -253,7 +275,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
 
             bool optionsRead = readOptionsFromFile(options, optionsFileName);
             if (optionsRead && !isQuiet()) {
-                printf("Building with options:\n%s\n", options.c_str());
+                printMessage("Building with options:\n%s\n", options.c_str());
             }
 
             std::string internalOptionsFileName = inputFile.substr(0, ext_start);
@@ -262,7 +284,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
             std::string internalOptionsFromFile;
             bool internalOptionsRead = readOptionsFromFile(internalOptionsFromFile, internalOptionsFileName);
             if (internalOptionsRead && !isQuiet()) {
-                printf("Building with internal options:\n%s\n", internalOptionsFromFile.c_str());
+                printMessage("Building with internal options:\n%s\n", internalOptionsFromFile.c_str());
             }
             CompilerOptions::concatenateAppend(internalOptions, internalOptionsFromFile);
         }
@@ -287,7 +309,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
     if ((inputFileSpirV == false) && (inputFileLlvm == false)) {
         auto fclLibFile = OsLibrary::load(Os::frontEndDllName);
         if (fclLibFile == nullptr) {
-            printf("Error: Failed to load %s\n", Os::frontEndDllName);
+            printMessage("Error: Failed to load %s\n", Os::frontEndDllName);
             return CL_OUT_OF_HOST_MEMORY;
         }
 
@@ -307,7 +329,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
         }
 
         if (false == this->fclMain->IsCompatible<IGC::FclOclDeviceCtx>()) {
-            printf("Incompatible interface in FCL : %s\n", CIF::InterfaceIdCoder::Dec(this->fclMain->FindIncompatible<IGC::FclOclDeviceCtx>()).c_str());
+            printMessage("Incompatible interface in FCL : %s\n", CIF::InterfaceIdCoder::Dec(this->fclMain->FindIncompatible<IGC::FclOclDeviceCtx>()).c_str());
             DEBUG_BREAK_IF(true);
             return CL_OUT_OF_HOST_MEMORY;
         }
@@ -321,7 +343,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
         preferredIntermediateRepresentation = fclDeviceCtx->GetPreferredIntermediateRepresentation();
     } else {
         if (!isQuiet()) {
-            printf("Compilation from IR - skipping loading of FCL\n");
+            printMessage("Compilation from IR - skipping loading of FCL\n");
         }
         preferredIntermediateRepresentation = IGC::CodeType::spirV;
     }
@@ -343,14 +365,14 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
 
     std::vector<CIF::InterfaceId_t> interfacesToIgnore = {IGC::OclGenBinaryBase::GetInterfaceId()};
     if (false == this->igcMain->IsCompatible<IGC::IgcOclDeviceCtx>(&interfacesToIgnore)) {
-        printf("Incompatible interface in IGC : %s\n", CIF::InterfaceIdCoder::Dec(this->igcMain->FindIncompatible<IGC::IgcOclDeviceCtx>(&interfacesToIgnore)).c_str());
+        printMessage("Incompatible interface in IGC : %s\n", CIF::InterfaceIdCoder::Dec(this->igcMain->FindIncompatible<IGC::IgcOclDeviceCtx>(&interfacesToIgnore)).c_str());
         DEBUG_BREAK_IF(true);
         return CL_OUT_OF_HOST_MEMORY;
     }
 
     CIF::Version_t verMin = 0, verMax = 0;
     if (false == this->igcMain->FindSupportedVersions<IGC::IgcOclDeviceCtx>(IGC::OclGenBinaryBase::GetInterfaceId(), verMin, verMax)) {
-        printf("Patchtoken interface is missing");
+        printMessage("Patchtoken interface is missing");
         return CL_OUT_OF_HOST_MEMORY;
     }
 
@@ -463,7 +485,7 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
             printUsage();
             retVal = PRINT_USAGE;
         } else {
-            printf("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
+            printMessage("Invalid option (arg %d): %s\n", argIndex, argv[argIndex].c_str());
             retVal = INVALID_COMMAND_LINE;
             break;
         }
@@ -471,21 +493,21 @@ int OfflineCompiler::parseCommandLine(size_t numArgs, const std::vector<std::str
 
     if (retVal == CL_SUCCESS) {
         if (compile32 && compile64) {
-            printf("Error: Cannot compile for 32-bit and 64-bit, please choose one.\n");
+            printMessage("Error: Cannot compile for 32-bit and 64-bit, please choose one.\n");
             retVal = INVALID_COMMAND_LINE;
         } else if (inputFile.empty()) {
-            printf("Error: Input file name missing.\n");
+            printMessage("Error: Input file name missing.\n");
             retVal = INVALID_COMMAND_LINE;
         } else if (deviceName.empty()) {
-            printf("Error: Device name missing.\n");
+            printMessage("Error: Device name missing.\n");
             retVal = INVALID_COMMAND_LINE;
         } else if (!fileExists(inputFile)) {
-            printf("Error: Input file %s missing.\n", inputFile.c_str());
+            printMessage("Error: Input file %s missing.\n", inputFile.c_str());
             retVal = INVALID_FILE;
         } else {
             retVal = getHardwareInfo(deviceName.c_str());
             if (retVal != CL_SUCCESS) {
-                printf("Error: Cannot get HW Info for device %s.\n", deviceName.c_str());
+                printMessage("Error: Cannot get HW Info for device %s.\n", deviceName.c_str());
             } else {
                 std::string extensionsList = getExtensionsList(*hwInfo);
                 CompilerOptions::concatenateAppend(internalOptions, convertEnabledExtensionsToCompilerInternalOptions(extensionsList.c_str()));
@@ -598,7 +620,7 @@ std::string getDevicesTypes() {
 }
 
 void OfflineCompiler::printUsage() {
-    printf(R"===(Compiles input file to Intel OpenCL GPU device binary (*.bin).
+    printMessage(R"===(Compiles input file to Intel OpenCL GPU device binary (*.bin).
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
@@ -681,7 +703,7 @@ Examples :
   Compile file to Intel OpenCL GPU device binary (out = source_file_Gen9core.bin)
     ocloc -file source_file.cl -device skl
 )===",
-           NEO::getDevicesTypes().c_str());
+                 NEO::getDevicesTypes().c_str());
 }
 
 void OfflineCompiler::storeBinary(
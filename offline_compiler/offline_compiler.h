@@ -34,7 +34,8 @@ std::string getDevicesTypes();
 
 class OfflineCompiler {
   public:
-    static OfflineCompiler *create(size_t numArgs, const std::vector<std::string> &allArgs, int &retVal);
+    // messages are printed to stdout, or appended to messagesOutput when it is given
+    static OfflineCompiler *create(size_t numArgs, const std::vector<std::string> &allArgs, int &retVal, std::string *messagesOutput = nullptr);
     int build();
     std::string &getBuildLog();
     void printUsage();
@@ -64,6 +65,7 @@ class OfflineCompiler {
     void storeBinary(char *&pDst, size_t &dstSize, const void *pSrc, const size_t srcSize);
     int buildSourceCode();
     void updateBuildLog(const char *pErrorString, const size_t errorStringSize);
+    void printMessage(const char *format, ...);
     bool generateElfBinary();
     std::string generateFilePathForIr(const std::string &fileNameBase) {
         const char *ext = (isSpirV) ? ".spv" : ".bc";
@@ -87,6 +89,7 @@ class OfflineCompiler {
     std::string internalOptions;
     std::string sourceCode;
     std::string buildLog;
+    std::string *messagesOutput = nullptr;
 
     bool useLlvmText = false;
     bool useLlvmBc = false;
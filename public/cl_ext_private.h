@@ -72,6 +72,15 @@ using cl_unified_shared_memory_capabilities_intel = cl_bitfield;
 typedef cl_uint cl_execution_info_intel;
 #define CL_EXECUTION_INFO_MAX_WORKGROUP_COUNT_INTEL 0x10100
 
+/******************************
+*        COMMAND LISTS        *
+*******************************/
+
+typedef struct _cl_command_list_intel *cl_command_list_intel;
+
+/* cl_command_type */
+#define CL_COMMAND_COMMAND_LIST_INTEL 0x10110
+
 /******************************
 *        UNIFIED MEMORY       *
 *******************************/
@@ -19,6 +19,7 @@
 #include "runtime/api/additional_extensions.h"
 #include "runtime/aub/aub_center.h"
 #include "runtime/built_ins/built_ins.h"
+#include "runtime/command_queue/command_list.h"
 #include "runtime/command_queue/command_queue.h"
 #include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/context/context.h"
@@ -37,6 +38,7 @@
 #include "runtime/mem_obj/image.h"
 #include "runtime/mem_obj/mem_obj_helper.h"
 #include "runtime/mem_obj/pipe.h"
+#include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/os_context.h"
 #include "runtime/platform/platform.h"
 #include "runtime/program/program.h"
@@ -1913,7 +1915,7 @@ cl_event CL_API_CALL clCreateUserEvent(cl_context context,
         return retVal;
     }
 
-    Event *userEvent = new UserEvent(ctx);
+    Event *userEvent = new (ctx->getObjectPool()) UserEvent(ctx);
     cl_event userClEvent = userEvent;
     DBG_LOG_INPUTS("cl_event", userClEvent, "UserEvent", userEvent);
 
@@ -3980,6 +3982,14 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clGetDeviceGlobalVariablePointerINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetExecutionInfoINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDRangeKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCreateCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clRetainCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandListNDRangeKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandListCopyBufferINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clFinalizeCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandListINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseHostPtrAllocationsINTEL);
 
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
@@ -5306,3 +5316,206 @@ cl_int CL_API_CALL clEnqueueNDRangeKernelINTEL(cl_command_queue commandQueue,
     DBG_LOG_INPUTS("event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
     return retVal;
 }
+
+cl_command_list_intel CL_API_CALL clCreateCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue);
+
+    CommandQueue *pCommandQueue = nullptr;
+    cl_command_list_intel commandList = nullptr;
+
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+
+    if (CL_SUCCESS == retVal) {
+        commandList = CommandList::create(pCommandQueue, retVal);
+    }
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return commandList;
+}
+
+cl_int CL_API_CALL clRetainCommandListINTEL(
+    cl_command_list_intel commandList) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList);
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    pCommandList->retain();
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandListINTEL(
+    cl_command_list_intel commandList) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList);
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    pCommandList->release();
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandListNDRangeKernelINTEL(
+    cl_command_list_intel commandList,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList, "cl_kernel", kernel,
+                   "globalWorkOffset", NEO::FileLoggerInstance().getSizes(globalWorkOffset, workDim, false),
+                   "globalWorkSize", NEO::FileLoggerInstance().getSizes(globalWorkSize, workDim, true),
+                   "localWorkSize", NEO::FileLoggerInstance().getSizes(localWorkSize, workDim, true));
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    Kernel *pKernel = nullptr;
+    retVal = validateObjects(WithCastToInternal(kernel, &pKernel));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    if ((workDim == 0) || (workDim > pCommandList->getCommandQueue().getDevice().getDeviceInfo().maxWorkItemDimensions)) {
+        retVal = CL_INVALID_WORK_DIMENSION;
+        return retVal;
+    }
+
+    TakeOwnershipWrapper<Kernel> kernelOwnership(*pKernel);
+    retVal = pCommandList->appendKernel(*pKernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandListCopyBufferINTEL(
+    cl_command_list_intel commandList,
+    cl_mem srcBuffer,
+    cl_mem dstBuffer,
+    size_t srcOffset,
+    size_t dstOffset,
+    size_t cb) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList,
+                   "srcBuffer", srcBuffer,
+                   "dstBuffer", dstBuffer,
+                   "srcOffset", srcOffset,
+                   "dstOffset", dstOffset,
+                   "cb", cb);
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    Buffer *pSrcBuffer = nullptr;
+    Buffer *pDstBuffer = nullptr;
+    retVal = validateObjects(
+        WithCastToInternal(srcBuffer, &pSrcBuffer),
+        WithCastToInternal(dstBuffer, &pDstBuffer));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    if (srcOffset + cb > pSrcBuffer->getSize() || dstOffset + cb > pDstBuffer->getSize()) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandList->appendCopyBuffer(*pSrcBuffer, *pDstBuffer, srcOffset, dstOffset, cb);
+    return retVal;
+}
+
+cl_int CL_API_CALL clFinalizeCommandListINTEL(
+    cl_command_list_intel commandList) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandList", commandList);
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandList->finalize();
+    return retVal;
+}
+
+cl_int CL_API_CALL clEnqueueCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_command_list_intel commandList,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue,
+                   "commandList", commandList,
+                   "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(
+        WithCastToInternal(commandQueue, &pCommandQueue),
+        EventWaitList(numEventsInWaitList, eventWaitList));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    auto pCommandList = castToObject<CommandList>(commandList);
+    if (!pCommandList) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandQueue->enqueueCommandList(*pCommandList, numEventsInWaitList, eventWaitList, event);
+
+    DBG_LOG_INPUTS("event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseHostPtrAllocationsINTEL(
+    cl_context context,
+    const void *ptr,
+    size_t size) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("context", context, "ptr", ptr, "size", size);
+
+    Context *pContext = nullptr;
+    retVal = validateObjects(WithCastToInternal(context, &pContext));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    if (ptr == nullptr || size == 0) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    pContext->getMemoryManager()->releaseHostPtrAllocationsOnAllEngines(ptr, size);
+    return retVal;
+}
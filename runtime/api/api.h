@@ -1046,6 +1046,47 @@ cl_int CL_API_CALL clEnqueueNDRangeKernelINTEL(cl_command_queue commandQueue,
                                                const cl_event *eventWaitList,
                                                cl_event *event);
 
+cl_command_list_intel CL_API_CALL clCreateCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet);
+
+cl_int CL_API_CALL clRetainCommandListINTEL(
+    cl_command_list_intel commandList);
+
+cl_int CL_API_CALL clReleaseCommandListINTEL(
+    cl_command_list_intel commandList);
+
+cl_int CL_API_CALL clCommandListNDRangeKernelINTEL(
+    cl_command_list_intel commandList,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize);
+
+cl_int CL_API_CALL clCommandListCopyBufferINTEL(
+    cl_command_list_intel commandList,
+    cl_mem srcBuffer,
+    cl_mem dstBuffer,
+    size_t srcOffset,
+    size_t dstOffset,
+    size_t cb);
+
+cl_int CL_API_CALL clFinalizeCommandListINTEL(
+    cl_command_list_intel commandList);
+
+cl_int CL_API_CALL clEnqueueCommandListINTEL(
+    cl_command_queue commandQueue,
+    cl_command_list_intel commandList,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event);
+
+cl_int CL_API_CALL clReleaseHostPtrAllocationsINTEL(
+    cl_context context,
+    const void *ptr,
+    size_t size);
+
 // OpenCL 2.2
 
 cl_int CL_API_CALL clSetProgramSpecializationConstant(
@@ -19,6 +19,9 @@ struct ClDispatch {
 struct _cl_accelerator_intel : public ClDispatch {
 };
 
+struct _cl_command_list_intel : public ClDispatch {
+};
+
 struct _cl_command_queue : public ClDispatch {
 };
 
@@ -10,6 +10,7 @@
 #include "core/compiler_interface/compiler_interface.h"
 #include "core/helpers/basic_math.h"
 #include "core/helpers/debug_helpers.h"
+#include "core/helpers/string.h"
 #include "runtime/built_ins/aux_translation_builtin.h"
 #include "runtime/built_ins/built_ins.inl"
 #include "runtime/built_ins/sip.h"
@@ -205,6 +206,13 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
     }
     template <typename OffsetType>
     bool buildDispatchInfosTyped(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
+        // Pattern without srcMemObj is passed by value in srcPtr
+        bool immediatePattern = (operationParams.srcMemObj == nullptr);
+        if (immediatePattern && !supportsImmediatePattern()) {
+            // builtins built without the immediate kernels, caller falls back to a pattern allocation
+            return false;
+        }
+
         DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::KernelSplit> kernelSplit1DBuilder;
         multiDispatchInfo.setBuiltinOpParams(operationParams);
         uintptr_t start = reinterpret_cast<uintptr_t>(operationParams.dstPtr) + operationParams.dstOffset.x;
@@ -434,11 +442,21 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
                  "",
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
-                 "FillBufferRightLeftover", kernRightLeftover);
+                 "FillBufferRightLeftover", kernRightLeftover,
+                 "FillBufferImmediateLeftLeftover", kernImmediateLeftLeftover,
+                 "FillBufferImmediateMiddle", kernImmediateMiddle,
+                 "FillBufferImmediateRightLeftover", kernImmediateRightLeftover);
     }
 
     template <typename OffsetType>
     bool buildDispatchInfosTyped(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const {
+        // Pattern without srcMemObj is passed by value in srcPtr
+        bool immediatePattern = (operationParams.srcMemObj == nullptr);
+        if (immediatePattern && !supportsImmediatePattern()) {
+            // builtins built without the immediate kernels, caller falls back to a pattern allocation
+            return false;
+        }
+
         DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::KernelSplit> kernelSplit1DBuilder;
         multiDispatchInfo.setBuiltinOpParams(operationParams);
         uintptr_t start = reinterpret_cast<uintptr_t>(operationParams.dstPtr) + operationParams.dstOffset.x;
@@ -457,12 +475,14 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
+        size_t patternSize = immediatePattern ? operationParams.patternSize : operationParams.srcMemObj->getSize();
+
         // Set-up ISA
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover);
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle);
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, immediatePattern ? kernImmediateLeftLeftover : kernLeftLeftover);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, immediatePattern ? kernImmediateMiddle : kernMiddle);
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, immediatePattern ? kernImmediateRightLeftover : kernRightLeftover);
 
-        DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
+        DEBUG_BREAK_IF((immediatePattern && (operationParams.srcPtr == nullptr || patternSize > maxImmediateFillPatternSize)) || (operationParams.srcOffset != 0));
         DEBUG_BREAK_IF((operationParams.dstMemObj == nullptr) && (operationParams.dstSvmAlloc == nullptr));
 
         // Set-up dstMemObj with buffer
@@ -477,13 +497,19 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 1, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Right, 1, static_cast<OffsetType>(operationParams.dstOffset.x + leftSize + middleSizeBytes));
 
-        // Set-up srcMemObj with pattern
-        kernelSplit1DBuilder.setArgSvm(2, operationParams.srcMemObj->getSize(), operationParams.srcMemObj->getGraphicsAllocation()->getUnderlyingBuffer(), operationParams.srcMemObj->getGraphicsAllocation(), CL_MEM_READ_ONLY);
+        // Set-up pattern
+        if (immediatePattern) {
+            uint32_t immediatePatternValue[maxImmediateFillPatternSize / sizeof(uint32_t)] = {};
+            memcpy_s(immediatePatternValue, sizeof(immediatePatternValue), operationParams.srcPtr, patternSize);
+            kernelSplit1DBuilder.setArg(2, sizeof(immediatePatternValue), immediatePatternValue);
+        } else {
+            kernelSplit1DBuilder.setArgSvm(2, patternSize, operationParams.srcMemObj->getGraphicsAllocation()->getUnderlyingBuffer(), operationParams.srcMemObj->getGraphicsAllocation(), CL_MEM_READ_ONLY);
+        }
 
         // Set-up patternSizeInEls
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Left, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize() / middleElSize));
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Right, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
+        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Left, 3, static_cast<OffsetType>(patternSize));
+        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 3, static_cast<OffsetType>(patternSize / middleElSize));
+        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Right, 3, static_cast<OffsetType>(patternSize));
 
         // Set-up work sizes
         // Note for split walker, it would be just builder.SetDipatchGeomtry(GWS, ELWS, OFFSET)
@@ -500,9 +526,16 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
     }
 
   protected:
+    bool supportsImmediatePattern() const {
+        return (kernImmediateLeftLeftover != nullptr) && (kernImmediateMiddle != nullptr) && (kernImmediateRightLeftover != nullptr);
+    }
+
     Kernel *kernLeftLeftover = nullptr;
     Kernel *kernMiddle = nullptr;
     Kernel *kernRightLeftover = nullptr;
+    Kernel *kernImmediateLeftLeftover = nullptr;
+    Kernel *kernImmediateMiddle = nullptr;
+    Kernel *kernImmediateRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib) : BuiltinDispatchInfoBuilder(kernelsLib) {}
 };
@@ -516,7 +549,10 @@ class BuiltInOp<EBuiltInOps::FillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
-                 "FillBufferRightLeftover", kernRightLeftover);
+                 "FillBufferRightLeftover", kernRightLeftover,
+                 "FillBufferImmediateLeftLeftover", kernImmediateLeftLeftover,
+                 "FillBufferImmediateMiddle", kernImmediateMiddle,
+                 "FillBufferImmediateRightLeftover", kernImmediateRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfo, const BuiltinOpParams &operationParams) const override {
         return buildDispatchInfosTyped<uint64_t>(multiDispatchInfo, operationParams);
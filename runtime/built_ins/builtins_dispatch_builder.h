@@ -30,6 +30,8 @@ class MemObj;
 struct MultiDispatchInfo;
 class Program;
 
+constexpr size_t maxImmediateFillPatternSize = 4 * sizeof(uint32_t);
+
 struct BuiltinOpParams {
     void *srcPtr = nullptr;
     void *dstPtr = nullptr;
@@ -49,6 +51,7 @@ struct BuiltinOpParams {
     size_t dstSlicePitch = 0;
     uint32_t srcMipLevel = 0;
     uint32_t dstMipLevel = 0;
+    size_t patternSize = 0; // fill pattern passed by value in srcPtr, when srcMemObj is not set
 };
 
 class BuiltinDispatchInfoBuilder {
@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_list.h"
+
+#include "core/command_stream/preemption.h"
+#include "core/helpers/hw_helper.h"
+#include "core/helpers/ptr_math.h"
+#include "core/helpers/string.h"
+#include "runtime/built_ins/built_ins.h"
+#include "runtime/built_ins/builtins_dispatch_builder.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/command_stream/scratch_space_controller.h"
+#include "runtime/device/device.h"
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/helpers/dispatch_info_builder.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/mem_obj/buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+CommandList *CommandList::create(CommandQueue *commandQueue, cl_int &errcodeRet) {
+    errcodeRet = CL_SUCCESS;
+
+    auto commandList = new CommandList(*commandQueue);
+    if (!commandList->commandContainer.initialize(&commandQueue->getDevice())) {
+        delete commandList;
+        errcodeRet = CL_OUT_OF_HOST_MEMORY;
+        return nullptr;
+    }
+
+    auto ssh = commandList->commandContainer.getIndirectHeap(IndirectHeap::SURFACE_STATE);
+    commandQueue->getGpgpuCommandStreamReceiver().getScratchSpaceController()->reserveHeap(IndirectHeap::SURFACE_STATE, ssh);
+
+    return commandList;
+}
+
+CommandList::CommandList(CommandQueue &commandQueue) : commandQueue(commandQueue) {
+    commandQueue.incRefInternal();
+}
+
+CommandList::~CommandList() {
+    if (submitted) {
+        commandQueue.waitUntilComplete(lastTaskCount, lastFlushStamp, false);
+    }
+    for (auto kernel : retainedKernels) {
+        kernel->decRefInternal();
+    }
+    for (auto memObj : retainedMemObjs) {
+        memObj->decRefInternal();
+    }
+    commandQueue.decRefInternal();
+}
+
+cl_int CommandList::appendKernel(Kernel &kernel, cl_uint workDim, const size_t *globalWorkOffsetIn,
+                                 const size_t *globalWorkSizeIn, const size_t *localWorkSizeIn) {
+    size_t region[3] = {1, 1, 1};
+    size_t globalWorkOffset[3] = {0, 0, 0};
+    size_t workGroupSize[3] = {1, 1, 1};
+    size_t enqueuedLocalWorkSize[3] = {0, 0, 0};
+
+    const auto &kernelInfo = kernel.getKernelInfo();
+
+    TakeOwnershipWrapper<CommandList> commandListOwnership(*this);
+
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+
+    if (!kernel.isPatched()) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+
+    // All dispatches of a kernel are patched from its current arguments, so they have to be recorded with the same ones
+    if (!matchesRecordedArguments(kernel)) {
+        return CL_INVALID_OPERATION;
+    }
+
+    // Only kernels whose state lives entirely in crossthread data and buffer surface states can be replayed
+    if (kernel.isParentKernel || kernel.hasPrintfOutput() || kernel.isAuxTranslationRequired() || kernel.usesSyncBuffer() ||
+        kernel.isUsingSharedObjArgs() || kernel.isVmeKernel() || kernelInfo.builtinDispatchBuilder != nullptr) {
+        return CL_INVALID_OPERATION;
+    }
+    for (auto &kernelArgument : kernel.getKernelArguments()) {
+        if (kernelArgument.type == Kernel::IMAGE_OBJ || kernelArgument.type == Kernel::PIPE_OBJ ||
+            kernelArgument.type == Kernel::SAMPLER_OBJ || kernelArgument.type == Kernel::ACCELERATOR_OBJ ||
+            kernelArgument.type == Kernel::DEVICE_QUEUE_OBJ) {
+            return CL_INVALID_OPERATION;
+        }
+    }
+
+    bool haveRequiredWorkGroupSize = (kernelInfo.reqdWorkGroupSize[0] != WorkloadInfo::undefinedOffset);
+    size_t remainder = 0;
+    size_t totalWorkItems = 1u;
+    const size_t *localWkgSizeToPass = localWorkSizeIn ? workGroupSize : nullptr;
+
+    for (auto i = 0u; i < workDim; i++) {
+        region[i] = globalWorkSizeIn ? globalWorkSizeIn[i] : 0;
+        if (region[i] == 0) {
+            return CL_INVALID_GLOBAL_WORK_SIZE;
+        }
+        globalWorkOffset[i] = globalWorkOffsetIn ? globalWorkOffsetIn[i] : 0;
+
+        if (localWorkSizeIn) {
+            if (haveRequiredWorkGroupSize && kernelInfo.reqdWorkGroupSize[i] != localWorkSizeIn[i]) {
+                return CL_INVALID_WORK_GROUP_SIZE;
+            }
+            if (localWorkSizeIn[i] == 0) {
+                return CL_INVALID_WORK_GROUP_SIZE;
+            }
+            if (kernel.getAllowNonUniform()) {
+                workGroupSize[i] = std::min(localWorkSizeIn[i], region[i]);
+            } else {
+                workGroupSize[i] = localWorkSizeIn[i];
+            }
+            enqueuedLocalWorkSize[i] = localWorkSizeIn[i];
+            totalWorkItems *= localWorkSizeIn[i];
+        }
+
+        remainder += region[i] % workGroupSize[i];
+    }
+
+    if (remainder != 0 && !kernel.getAllowNonUniform()) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+
+    if (totalWorkItems > kernel.maxKernelWorkGroupSize) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+
+    if (haveRequiredWorkGroupSize) {
+        localWkgSizeToPass = kernelInfo.reqdWorkGroupSize;
+    }
+
+    MultiDispatchInfo multiDispatchInfo(&kernel);
+    DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder;
+    builder.setDispatchGeometry(workDim, region, enqueuedLocalWorkSize, globalWorkOffset, Vec3<size_t>{0, 0, 0}, localWkgSizeToPass);
+    builder.setKernel(&kernel);
+    builder.bake(multiDispatchInfo);
+
+    return appendDispatch(multiDispatchInfo, true);
+}
+
+cl_int CommandList::appendCopyBuffer(Buffer &srcBuffer, Buffer &dstBuffer, size_t srcOffset, size_t dstOffset, size_t size) {
+    TakeOwnershipWrapper<CommandList> commandListOwnership(*this);
+
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+
+    auto &device = commandQueue.getDevice();
+    auto &builder = device.getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer,
+                                                                                                  commandQueue.getContext(),
+                                                                                                  device);
+    BuiltInOwnershipWrapper builtInLock(builder, commandQueue.getContextPtr());
+
+    MultiDispatchInfo multiDispatchInfo;
+    BuiltinOpParams operationParams;
+    operationParams.srcMemObj = &srcBuffer;
+    operationParams.dstMemObj = &dstBuffer;
+    operationParams.srcOffset = {srcOffset, 0, 0};
+    operationParams.dstOffset = {dstOffset, 0, 0};
+    operationParams.size = {size, 0, 0};
+    builder.buildDispatchInfos(multiDispatchInfo, operationParams);
+
+    // Builtin kernels are shared, their arguments are baked into the recorded heaps
+    auto retVal = appendDispatch(multiDispatchInfo, false);
+    if (retVal == CL_SUCCESS) {
+        for (auto buffer : {&srcBuffer, &dstBuffer}) {
+            commandContainer.addToResidencyContainer(buffer->getGraphicsAllocation());
+            buffer->incRefInternal();
+            retainedMemObjs.push_back(buffer);
+        }
+    }
+    return retVal;
+}
+
+cl_int CommandList::finalize() {
+    TakeOwnershipWrapper<CommandList> commandListOwnership(*this);
+
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+
+    auto retVal = commandQueue.closeCommandList(*this);
+    finalized = (retVal == CL_SUCCESS);
+    return retVal;
+}
+
+cl_int CommandList::appendDispatch(const MultiDispatchInfo &multiDispatchInfo, bool argumentsPatchable) {
+    auto retVal = commandQueue.recordCommandListDispatch(*this, multiDispatchInfo, argumentsPatchable);
+    if (retVal == CL_SUCCESS) {
+        preemptionMode = std::min(preemptionMode, PreemptionHelper::taskPreemptionMode(commandQueue.getDevice(), multiDispatchInfo));
+    }
+    return retVal;
+}
+
+void CommandList::recordDispatch(Kernel &kernel, size_t crossThreadDataOffset, size_t surfaceStateOffset, bool argumentsPatchable) {
+    recordedDispatches.push_back({&kernel, crossThreadDataOffset, surfaceStateOffset, kernel.slmTotalSize, argumentsPatchable});
+
+    if (std::find(retainedKernels.begin(), retainedKernels.end(), &kernel) == retainedKernels.end()) {
+        kernel.incRefInternal();
+        retainedKernels.push_back(&kernel);
+        commandContainer.addToResidencyContainer(kernel.getKernelInfo().getGraphicsAllocation());
+    }
+}
+
+template <typename ArgumentDataHandler>
+void CommandList::forEachArgumentData(const RecordedDispatch &recordedDispatch, ArgumentDataHandler &&handler) {
+    auto ioh = commandContainer.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+    auto ssh = commandContainer.getIndirectHeap(IndirectHeap::SURFACE_STATE);
+    // Kernel data is only read here, the non-const ssh accessor would mark the kernel ssh dirty
+    const Kernel &kernel = *recordedDispatch.kernel;
+
+    auto recordedCrossThreadData = ptrOffset(ioh->getCpuBase(), recordedDispatch.crossThreadDataOffset);
+    auto recordedSurfaceStates = ptrOffset(ssh->getCpuBase(), recordedDispatch.surfaceStateOffset);
+    auto surfaceStateSize = HwHelper::get(kernel.getDevice().getHardwareInfo().platform.eRenderCoreFamily).getRenderSurfaceStateSize();
+    const auto &kernelArguments = kernel.getKernelArguments();
+    const auto &kernelArgInfos = kernel.getKernelInfo().kernelArgInfo;
+
+    for (size_t argIndex = 0; argIndex < kernelArguments.size(); argIndex++) {
+        const auto &argInfo = kernelArgInfos[argIndex];
+        for (const auto &patchInfo : argInfo.kernelArgPatchInfoVector) {
+            handler(ptrOffset(recordedCrossThreadData, patchInfo.crossthreadOffset),
+                    ptrOffset(kernel.getCrossThreadData(), patchInfo.crossthreadOffset), patchInfo.size);
+        }
+        if (argInfo.offsetBufferOffset != KernelArgInfo::undefinedOffset) {
+            handler(ptrOffset(recordedCrossThreadData, argInfo.offsetBufferOffset),
+                    ptrOffset(kernel.getCrossThreadData(), argInfo.offsetBufferOffset), sizeof(uint32_t));
+        }
+        auto argType = kernelArguments[argIndex].type;
+        if (kernel.requiresSshForBuffers() &&
+            (argType == Kernel::BUFFER_OBJ || argType == Kernel::SVM_OBJ || argType == Kernel::SVM_ALLOC_OBJ)) {
+            handler(ptrOffset(recordedSurfaceStates, argInfo.offsetHeap),
+                    ptrOffset(kernel.getSurfaceStateHeap(), argInfo.offsetHeap), surfaceStateSize);
+        }
+    }
+}
+
+bool CommandList::matchesRecordedArguments(Kernel &kernel) {
+    for (auto &recordedDispatch : recordedDispatches) {
+        if (recordedDispatch.kernel != &kernel || !recordedDispatch.argumentsPatchable) {
+            continue;
+        }
+        bool argumentsMatch = true;
+        forEachArgumentData(recordedDispatch, [&](const void *recordedData, const void *currentData, size_t size) {
+            argumentsMatch &= (memcmp(recordedData, currentData, size) == 0);
+        });
+        if (!argumentsMatch) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CommandList::patchArguments() {
+    bool previousSubmissionCompleted = !submitted;
+
+    auto patchRecordedData = [&](void *recordedData, const void *currentData, size_t size) {
+        if (memcmp(recordedData, currentData, size) == 0) {
+            return;
+        }
+        // Recorded heaps are read by the GPU, the last submission has to retire before they change
+        if (!previousSubmissionCompleted) {
+            commandQueue.waitUntilComplete(lastTaskCount, lastFlushStamp, false);
+            previousSubmissionCompleted = true;
+        }
+        memcpy_s(recordedData, size, currentData, size);
+        patchCount++;
+    };
+
+    for (auto &recordedDispatch : recordedDispatches) {
+        if (!recordedDispatch.argumentsPatchable) {
+            continue;
+        }
+        auto &kernel = *recordedDispatch.kernel;
+        if (!kernel.isPatched() || kernel.slmTotalSize != recordedDispatch.slmTotalSize) {
+            return false;
+        }
+        forEachArgumentData(recordedDispatch, patchRecordedData);
+    }
+    return true;
+}
+
+void CommandList::makeResident(CommandStreamReceiver &commandStreamReceiver) {
+    for (auto allocation : commandContainer.getResidencyContainer()) {
+        commandStreamReceiver.makeResident(*allocation);
+    }
+    for (auto kernel : retainedKernels) {
+        if (std::any_of(recordedDispatches.begin(), recordedDispatches.end(), [kernel](const RecordedDispatch &recordedDispatch) {
+                return recordedDispatch.kernel == kernel && recordedDispatch.argumentsPatchable;
+            })) {
+            kernel->makeResident(commandStreamReceiver);
+        }
+    }
+}
+
+void CommandList::updateLastSubmission(uint32_t taskCount, FlushStamp flushStamp) {
+    submitted = true;
+    lastTaskCount = taskCount;
+    lastFlushStamp = flushStamp;
+}
+} // namespace NEO
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/command_container/cmdcontainer.h"
+#include "core/command_stream/preemption_mode.h"
+#include "core/helpers/completion_stamp.h"
+#include "runtime/api/cl_types.h"
+#include "runtime/helpers/base_object.h"
+
+#include <vector>
+
+namespace NEO {
+class Buffer;
+class CommandQueue;
+class CommandStreamReceiver;
+class Kernel;
+class MemObj;
+struct MultiDispatchInfo;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_list_intel> {
+    typedef class CommandList DerivedType;
+};
+
+// Sequence of kernel dispatches encoded once into a CommandContainer and submitted
+// from the owning queue with MI_BATCH_BUFFER_START. Kernel arguments changed between
+// submissions are patched in the recorded indirect heaps, nothing else is re-encoded.
+// A kernel appended more than once has to keep the same arguments in each of its dispatches.
+class CommandList : public BaseObject<_cl_command_list_intel> {
+  public:
+    static const cl_ulong objectMagic = 0x5A3C9E4D17B2F860LL;
+
+    struct RecordedDispatch {
+        Kernel *kernel;
+        size_t crossThreadDataOffset;
+        size_t surfaceStateOffset;
+        uint32_t slmTotalSize;
+        bool argumentsPatchable;
+    };
+
+    static CommandList *create(CommandQueue *commandQueue, cl_int &errcodeRet);
+
+    CommandList(CommandQueue &commandQueue);
+    ~CommandList() override;
+
+    // API entry points
+    cl_int appendKernel(Kernel &kernel, cl_uint workDim, const size_t *globalWorkOffset,
+                        const size_t *globalWorkSize, const size_t *localWorkSize);
+    cl_int appendCopyBuffer(Buffer &srcBuffer, Buffer &dstBuffer, size_t srcOffset, size_t dstOffset, size_t size);
+    cl_int finalize();
+
+    void recordDispatch(Kernel &kernel, size_t crossThreadDataOffset, size_t surfaceStateOffset, bool argumentsPatchable);
+    bool patchArguments();
+    void makeResident(CommandStreamReceiver &commandStreamReceiver);
+    void updateLastSubmission(uint32_t taskCount, FlushStamp flushStamp);
+
+    CommandQueue &getCommandQueue() const { return commandQueue; }
+    CommandContainer &getCommandContainer() { return commandContainer; }
+    const std::vector<RecordedDispatch> &getRecordedDispatches() const { return recordedDispatches; }
+    PreemptionMode getPreemptionMode() const { return preemptionMode; }
+    bool isFinalized() const { return finalized; }
+    uint32_t getPatchCount() const { return patchCount; }
+
+  protected:
+    cl_int appendDispatch(const MultiDispatchInfo &multiDispatchInfo, bool argumentsPatchable);
+    bool matchesRecordedArguments(Kernel &kernel);
+    template <typename ArgumentDataHandler>
+    void forEachArgumentData(const RecordedDispatch &recordedDispatch, ArgumentDataHandler &&handler);
+
+    CommandQueue &commandQueue;
+    CommandContainer commandContainer;
+    std::vector<RecordedDispatch> recordedDispatches;
+    std::vector<Kernel *> retainedKernels;
+    std::vector<MemObj *> retainedMemObjs;
+    PreemptionMode preemptionMode = PreemptionMode::MidThread;
+    bool finalized = false;
+
+    bool submitted = false;
+    uint32_t lastTaskCount = 0;
+    FlushStamp lastFlushStamp = 0;
+    uint32_t patchCount = 0;
+};
+} // namespace NEO
@@ -100,6 +100,11 @@ CommandQueue::~CommandQueue() {
         }
     }
 
+    for (auto memObj : deferredAuxTranslations) {
+        memObj->releaseDeferredAuxTranslation(this);
+        memObj->decRefInternal();
+    }
+
     timestampPacketContainer.reset();
     //for normal queue, decrement ref count on context
     //special queue is owned by context so ref count doesn't have to be decremented
@@ -108,6 +113,10 @@ CommandQueue::~CommandQueue() {
     }
 }
 
+ObjectPool *CommandQueue::getObjectPool() const {
+    return context ? context->getObjectPool() : nullptr;
+}
+
 CommandStreamReceiver &CommandQueue::getGpgpuCommandStreamReceiver() const {
     return *gpgpuEngine->commandStreamReceiver;
 }
@@ -498,12 +507,12 @@ void CommandQueue::enqueueBlockedMapUnmapOperation(const cl_event *eventWaitList
         eventBuilder = &externalEventBuilder;
     } else {
         // it will be an internal event
-        internalEventBuilder.create<VirtualEvent>(this, context);
+        internalEventBuilder.createFromPool<VirtualEvent>(getObjectPool(), this, context);
         eventBuilder = &internalEventBuilder;
     }
 
     //store task data in event
-    auto cmd = std::unique_ptr<Command>(new CommandMapUnmap(opType, *memObj, copySize, copyOffset, readOnly, *this));
+    auto cmd = std::unique_ptr<Command>(new (getObjectPool()) CommandMapUnmap(opType, *memObj, copySize, copyOffset, readOnly, *this));
     eventBuilder->getEvent()->setCommand(std::move(cmd));
 
     //bind output event with input events
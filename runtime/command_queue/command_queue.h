@@ -18,6 +18,7 @@
 namespace NEO {
 class BarrierCommand;
 class Buffer;
+class CommandList;
 class LinearStream;
 class Context;
 class Device;
@@ -38,6 +39,11 @@ enum class QueuePriority {
     HIGH
 };
 
+struct AuxTranslationStatistics {
+    uint64_t translationsAvoided = 0;
+    uint64_t deferredTranslationsRestored = 0;
+};
+
 inline bool shouldFlushDC(uint32_t commandType, PrintfHandler *printfHandler) {
     return (commandType == CL_COMMAND_READ_BUFFER ||
             commandType == CL_COMMAND_READ_BUFFER_RECT ||
@@ -308,10 +314,29 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return CL_SUCCESS;
     }
 
+    virtual cl_int recordCommandListDispatch(CommandList &commandList,
+                                             const MultiDispatchInfo &multiDispatchInfo,
+                                             bool argumentsPatchable) {
+        return CL_SUCCESS;
+    }
+
+    virtual cl_int closeCommandList(CommandList &commandList) { return CL_SUCCESS; }
+
+    virtual cl_int enqueueCommandList(CommandList &commandList,
+                                      cl_uint numEventsInWaitList,
+                                      const cl_event *eventWaitList,
+                                      cl_event *event) {
+        return CL_SUCCESS;
+    }
+
     virtual cl_int finish() { return CL_SUCCESS; }
 
     virtual cl_int flush() { return CL_SUCCESS; }
 
+    // translates back to aux the buffers left in non-aux state by previous stateless kernels
+    virtual void restoreDeferredAuxTranslations() {}
+    const AuxTranslationStatistics &getAuxTranslationStatistics() const { return auxTranslationStatistics; }
+
     MOCKABLE_VIRTUAL void updateFromCompletionStamp(const CompletionStamp &completionStamp);
 
     virtual bool isCacheFlushCommand(uint32_t commandType) const { return false; }
@@ -339,6 +364,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     Device &getDevice() const { return *device; }
     Context &getContext() const { return *context; }
     Context *getContextPtr() const { return context; }
+    ObjectPool *getObjectPool() const;
     EngineControl &getGpgpuEngine() const { return *gpgpuEngine; }
 
     MOCKABLE_VIRTUAL LinearStream &getCS(size_t minRequiredSize);
@@ -464,6 +490,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool requiresCacheFlushAfterWalker = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+
+    MemObjsForAuxTranslation deferredAuxTranslations;
+    AuxTranslationStatistics auxTranslationStatistics;
 };
 
 typedef CommandQueue *(*CommandQueueCreateFunc)(
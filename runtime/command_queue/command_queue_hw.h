@@ -292,8 +292,20 @@ class CommandQueueHw : public CommandQueue {
                                   const cl_event *eventWaitList,
                                   cl_event *event) override;
 
+    cl_int recordCommandListDispatch(CommandList &commandList,
+                                     const MultiDispatchInfo &multiDispatchInfo,
+                                     bool argumentsPatchable) override;
+
+    cl_int closeCommandList(CommandList &commandList) override;
+
+    cl_int enqueueCommandList(CommandList &commandList,
+                              cl_uint numEventsInWaitList,
+                              const cl_event *eventWaitList,
+                              cl_event *event) override;
+
     cl_int finish() override;
     cl_int flush() override;
+    void restoreDeferredAuxTranslations() override;
 
     template <uint32_t enqueueType>
     void enqueueHandler(Surface **surfacesForResidency,
@@ -393,8 +405,12 @@ class CommandQueueHw : public CommandQueue {
 
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
+    bool isAuxTranslationDeferralAllowed(bool blocking, cl_event *event) const;
+    void deferAuxTranslations(const MemObjsForAuxTranslation &memObjs);
 
     MOCKABLE_VIRTUAL bool forceStateless(size_t size);
+    static bool isFillPatternImmediate(size_t patternSize);
+    static size_t copyFillPattern(void *dst, const void *pattern, size_t patternSize);
 
     template <uint32_t commandType>
     LinearStream *obtainCommandStream(const CsrDependencies &csrDependencies, bool blitEnqueue, bool blockedQueue,
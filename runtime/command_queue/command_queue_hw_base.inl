@@ -7,6 +7,7 @@
 
 #include "runtime/built_ins/aux_translation_builtin.h"
 #include "runtime/command_queue/enqueue_barrier.h"
+#include "runtime/command_queue/enqueue_command_list.h"
 #include "runtime/command_queue/enqueue_copy_buffer.h"
 #include "runtime/command_queue/enqueue_copy_buffer_rect.h"
 #include "runtime/command_queue/enqueue_copy_buffer_to_image.h"
@@ -117,11 +118,86 @@ void CommandQueueHw<Family>::dispatchAuxTranslationBuiltin(MultiDispatchInfo &mu
     auxTranslationBuilder.buildDispatchInfosForAuxTranslation<Family>(multiDispatchInfo, dispatchParams);
 }
 
+template <typename Family>
+bool CommandQueueHw<Family>::isAuxTranslationDeferralAllowed(bool blocking, cl_event *event) const {
+    return DebugManager.flags.EnableDeferredAuxTranslation.get() &&
+           HwHelperHw<Family>::getAuxTranslationMode() == AuxTranslationMode::Builtin &&
+           !blocking && event == nullptr && !isOOQEnabled();
+}
+
+template <typename Family>
+void CommandQueueHw<Family>::deferAuxTranslations(const MemObjsForAuxTranslation &memObjs) {
+    for (auto memObj : memObjs) {
+        memObj->setDeferredAuxTranslationQueue(this);
+        // deferred objects are kept alive until they are translated back
+        if (deferredAuxTranslations.insert(memObj).second) {
+            memObj->incRefInternal();
+        }
+    }
+}
+
+template <typename Family>
+void CommandQueueHw<Family>::restoreDeferredAuxTranslations() {
+    auto commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    if (deferredAuxTranslations.empty()) {
+        return;
+    }
+
+    MemObjsForAuxTranslation deferredMemObjs;
+    MemObjsForAuxTranslation memObjsToRestore;
+    deferredMemObjs.swap(deferredAuxTranslations);
+    for (auto memObj : deferredMemObjs) {
+        // objects taken over by a kernel on another queue are translated back by that queue
+        if (memObj->releaseDeferredAuxTranslation(this)) {
+            memObjsToRestore.insert(memObj);
+        }
+    }
+
+    if (!memObjsToRestore.empty()) {
+        auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getContext(), getDevice());
+        BuiltInOwnershipWrapper builtInLock(builder, this->context);
+
+        MultiDispatchInfo multiDispatchInfo;
+        multiDispatchInfo.setMemObjsForAuxTranslation(memObjsToRestore);
+        dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
+        auxTranslationStatistics.deferredTranslationsRestored += memObjsToRestore.size();
+
+        NullSurface s;
+        Surface *surfaces[] = {&s};
+        enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(surfaces, false, multiDispatchInfo, 0, nullptr, nullptr);
+    }
+
+    for (auto memObj : deferredMemObjs) {
+        memObj->decRefInternal();
+    }
+}
+
 template <typename Family>
 bool CommandQueueHw<Family>::forceStateless(size_t size) {
     return size >= 4ull * MemoryConstants::gigaByte;
 }
 
+template <typename Family>
+bool CommandQueueHw<Family>::isFillPatternImmediate(size_t patternSize) {
+    return DebugManager.flags.EnableImmediateFillPattern.get() && patternSize <= maxImmediateFillPatternSize;
+}
+
+template <typename Family>
+size_t CommandQueueHw<Family>::copyFillPattern(void *dst, const void *pattern, size_t patternSize) {
+    // fill builtins operate on dwords, shorter patterns are replicated
+    if (patternSize == 1) {
+        int patternInt = (uint32_t)((*(uint8_t *)pattern << 24) | (*(uint8_t *)pattern << 16) | (*(uint8_t *)pattern << 8) | *(uint8_t *)pattern);
+        memcpy_s(dst, sizeof(int), &patternInt, sizeof(int));
+        return sizeof(int);
+    } else if (patternSize == 2) {
+        int patternInt = (uint32_t)((*(uint16_t *)pattern << 16) | *(uint16_t *)pattern);
+        memcpy_s(dst, sizeof(int), &patternInt, sizeof(int));
+        return sizeof(int);
+    }
+    memcpy_s(dst, patternSize, pattern, patternSize);
+    return patternSize;
+}
+
 template <typename Family>
 void CommandQueueHw<Family>::setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo) {
     multiDispatchInfo.begin()->dispatchInitCommands.registerMethod(
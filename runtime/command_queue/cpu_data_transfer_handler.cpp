@@ -44,7 +44,7 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
     }
 
     if (eventsRequest.outEvent) {
-        eventBuilder.create<Event>(this, transferProperties.cmdType, Event::eventNotReady, Event::eventNotReady);
+        eventBuilder.createFromPool<Event>(getObjectPool(), this, transferProperties.cmdType, Event::eventNotReady, Event::eventNotReady);
         outEventObj = eventBuilder.getEvent();
         outEventObj->setQueueTimeStamp();
         outEventObj->setCPUProfilingPath(true);
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/command_stream/linear_stream.h"
+#include "core/command_stream/preemption.h"
+#include "core/kernel/grf_config.h"
+#include "runtime/command_queue/command_list.h"
+#include "runtime/command_queue/command_queue_hw.h"
+#include "runtime/command_queue/gpgpu_walker.h"
+#include "runtime/command_queue/hardware_interface.h"
+#include "runtime/command_stream/command_stream_receiver_hw.h"
+#include "runtime/command_stream/csr_definitions.h"
+#include "runtime/device/device.h"
+#include "runtime/event/event.h"
+#include "runtime/event/event_builder.h"
+#include "runtime/helpers/hardware_commands_helper.h"
+#include "runtime/helpers/properties_helper.h"
+#include "runtime/helpers/timestamp_packet.h"
+#include "runtime/kernel/kernel.h"
+#include "runtime/os_interface/os_time.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::recordCommandListDispatch(CommandList &commandList,
+                                                            const MultiDispatchInfo &multiDispatchInfo,
+                                                            bool argumentsPatchable) {
+    using BINDING_TABLE_STATE = typename GfxFamily::BINDING_TABLE_STATE;
+
+    auto &commandContainer = commandList.getCommandContainer();
+    auto &commandStream = *commandContainer.getCommandStream();
+    auto &dsh = *commandContainer.getIndirectHeap(IndirectHeap::DYNAMIC_STATE);
+    auto &ioh = *commandContainer.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+    auto &ssh = *commandContainer.getIndirectHeap(IndirectHeap::SURFACE_STATE);
+
+    HardwareInterface<GfxFamily>::setLocalWorkgroupSizes(multiDispatchInfo);
+
+    // Container buffers are never replaced, so everything has to fit before anything is encoded.
+    // Space for the trailing MI_BATCH_BUFFER_END is always kept.
+    size_t requiredSizeCS = sizeof(typename GfxFamily::MI_BATCH_BUFFER_END);
+    size_t requiredSizeDSH = 0, requiredSizeIOH = 0, requiredSizeSSH = 0;
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        MultiDispatchInfo singleDispatchInfo(dispatchInfo.getKernel());
+        singleDispatchInfo.push(dispatchInfo);
+        requiredSizeCS += PipeControlHelper<GfxFamily>::getSizeForSinglePipeControl() +
+                          EnqueueOperation<GfxFamily>::getTotalSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, CsrDependencies(), false, false, false,
+                                                                              *this, singleDispatchInfo);
+        requiredSizeDSH += HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredDSH(singleDispatchInfo);
+        requiredSizeIOH += HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredIOH(singleDispatchInfo);
+        requiredSizeSSH += HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredSSH(singleDispatchInfo);
+    }
+    if (commandStream.getAvailableSpace() < requiredSizeCS || dsh.getAvailableSpace() < requiredSizeDSH ||
+        ioh.getAvailableSpace() < requiredSizeIOH || ssh.getAvailableSpace() < requiredSizeSSH) {
+        return CL_OUT_OF_RESOURCES;
+    }
+
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        auto &kernel = *dispatchInfo.getKernel();
+
+        // Dispatches of the list run in recording order
+        if (commandStream.getUsed() > 0) {
+            PipeControlHelper<GfxFamily>::addPipeControl(commandStream, false);
+        }
+
+        // Offsets match the ones used by sendIndirectState, they locate argument data for patching on replay
+        ioh.align(WALKER_TYPE<GfxFamily>::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+        ssh.align(BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+        auto crossThreadDataOffset = ioh.getUsed();
+        auto surfaceStateOffset = ssh.getUsed();
+        kernel.getDispatchTemplate().markSurfaceStateHeapDirty();
+
+        MultiDispatchInfo singleDispatchInfo(&kernel);
+        singleDispatchInfo.push(dispatchInfo);
+        HardwareInterface<GfxFamily>::dispatchWalker(
+            *this,
+            singleDispatchInfo,
+            CsrDependencies(),
+            commandStream,
+            dsh,
+            ioh,
+            ssh,
+            nullptr,
+            nullptr,
+            nullptr,
+            nullptr,
+            CL_COMMAND_NDRANGE_KERNEL);
+
+        commandList.recordDispatch(kernel, crossThreadDataOffset, surfaceStateOffset, argumentsPatchable);
+    }
+
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::closeCommandList(CommandList &commandList) {
+    CommandStreamReceiverHw<GfxFamily>::addBatchBufferEnd(*commandList.getCommandContainer().getCommandStream(), nullptr);
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueCommandList(CommandList &commandList,
+                                                     cl_uint numEventsInWaitList,
+                                                     const cl_event *eventWaitList,
+                                                     cl_event *event) {
+    using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
+    using PIPE_CONTROL = typename GfxFamily::PIPE_CONTROL;
+
+    TakeOwnershipWrapper<CommandList> commandListOwnership(commandList);
+
+    if (!commandList.isFinalized() || &commandList.getCommandQueue() != this) {
+        return CL_INVALID_OPERATION;
+    }
+
+    // Recorded commands can't be stored for later submission, so dependencies must be resolvable now
+    if (isQueueBlocked() || Event::checkUserEventDependencies(numEventsInWaitList, eventWaitList)) {
+        return CL_INVALID_OPERATION;
+    }
+
+    auto &commandStreamReceiver = getGpgpuCommandStreamReceiver();
+
+    if (!commandList.patchArguments()) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+
+    auto commandStreamRecieverOwnership = commandStreamReceiver.obtainUniqueOwnership();
+
+    if (!deferredAuxTranslations.empty()) {
+        restoreDeferredAuxTranslations();
+    }
+
+    TimeStampData queueTimeStamp;
+    if (isProfilingEnabled() && event) {
+        this->getDevice().getOSTime()->getCpuGpuTime(&queueTimeStamp);
+    }
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.createFromPool<Event>(getObjectPool(), this, CL_COMMAND_COMMAND_LIST_INTEL, Event::eventNotReady, 0);
+        *event = eventBuilder.getEvent();
+        if (eventBuilder.getEvent()->isProfilingEnabled()) {
+            eventBuilder.getEvent()->setQueueTimeStamp(&queueTimeStamp);
+            eventBuilder.getEvent()->setCPUProfilingPath(true);
+        }
+    }
+
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    auto taskLevel = getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList);
+
+    // Same dependency handling as enqueueHandler: events of this CSR are waited for with semaphores
+    // in the queue stream, events of other CSRs go to flushTask through dispatchFlags.csrDependencies
+    bool timestampPacketWriteEnabled = commandStreamReceiver.peekTimestampPacketWriteEnabled();
+    TimestampPacketDependencies timestampPacketDependencies;
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+    CsrDependencies csrDeps;
+    size_t requiredSizeCS = PipeControlHelper<GfxFamily>::getSizeForSinglePipeControl() + sizeof(MI_BATCH_BUFFER_START);
+    if (timestampPacketWriteEnabled) {
+        csrDeps.fillFromEventsRequest(eventsRequest, commandStreamReceiver, CsrDependencies::DependenciesType::OnCsr);
+        obtainNewTimestampPacketNodes(1, timestampPacketDependencies.previousEnqueueNodes, false);
+        csrDeps.push_back(&timestampPacketDependencies.previousEnqueueNodes);
+        requiredSizeCS += TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(csrDeps) +
+                          PipeControlHelper<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(device->getHardwareInfo());
+    }
+
+    auto &commandContainer = commandList.getCommandContainer();
+    auto &commandStream = getCS(requiredSizeCS);
+    auto commandStreamStart = commandStream.getUsed();
+
+    TimestampPacketHelper::programCsrDependencies<GfxFamily>(commandStream, csrDeps);
+    PipeControlHelper<GfxFamily>::addPipeControl(commandStream, false);
+    auto bbStart = commandStream.getSpaceForCmd<MI_BATCH_BUFFER_START>();
+    static_cast<CommandStreamReceiverHw<GfxFamily> &>(commandStreamReceiver).addBatchBufferStart(bbStart, commandContainer.getCmdBufferAllocation()->getGpuAddress(), true);
+
+    if (timestampPacketWriteEnabled) {
+        // Recorded walkers carry no timestamp packet, the replay signals completion once the list returns
+        auto timestampPacketNode = timestampPacketContainer->peekNodes().at(0);
+        uint64_t address = timestampPacketNode->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd);
+        PipeControlHelper<GfxFamily>::obtainPipeControlAndProgramPostSyncOperation(commandStream, PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA,
+                                                                                   address, 0, false, device->getHardwareInfo());
+        timestampPacketContainer->makeResident(commandStreamReceiver);
+        timestampPacketDependencies.previousEnqueueNodes.makeResident(commandStreamReceiver);
+        if (eventBuilder.getEvent()) {
+            eventBuilder.getEvent()->addTimestampPacketNodes(*timestampPacketContainer);
+        }
+    }
+
+    commandList.makeResident(commandStreamReceiver);
+
+    uint32_t numGrfRequired = GrfConfig::DefaultGrfNumber;
+    uint32_t requiredScratchSize = 0;
+    uint32_t requiredPrivateScratchSize = 0;
+    bool useSlm = false;
+    bool requiresCoherency = false;
+    bool specialPipelineSelectMode = false;
+    bool anyUncacheableArgs = false;
+    bool anyStatelessWrites = false;
+    uint32_t threadArbitrationPolicy = ThreadArbitrationPolicy::NotPresent;
+    for (auto &recordedDispatch : commandList.getRecordedDispatches()) {
+        auto kernel = recordedDispatch.kernel;
+        if (threadArbitrationPolicy == ThreadArbitrationPolicy::NotPresent) {
+            threadArbitrationPolicy = kernel->getThreadArbitrationPolicy();
+        }
+        numGrfRequired = std::max(numGrfRequired, kernel->getKernelInfo().patchInfo.executionEnvironment->NumGRFRequired);
+        requiredScratchSize = std::max(requiredScratchSize, kernel->getScratchSize());
+        requiredPrivateScratchSize = std::max(requiredPrivateScratchSize, kernel->getPrivateScratchSize());
+        useSlm |= (recordedDispatch.slmTotalSize > 0);
+        requiresCoherency |= kernel->requiresCoherency();
+        specialPipelineSelectMode |= kernel->requiresSpecialPipelineSelectMode();
+        anyUncacheableArgs |= kernel->hasUncacheableStatelessArgs();
+        anyStatelessWrites |= kernel->areStatelessWritesUsed();
+    }
+    commandStreamReceiver.setRequiredScratchSizes(requiredScratchSize, requiredPrivateScratchSize);
+
+    TimeStampData submitTimeStamp;
+    if (eventBuilder.getEvent() && isProfilingEnabled()) {
+        this->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+        eventBuilder.getEvent()->setSubmitTimeStamp(&submitTimeStamp);
+        eventBuilder.getEvent()->setSubmitTimeStamp();
+        eventBuilder.getEvent()->setStartTimeStamp();
+    }
+
+    DispatchFlags dispatchFlags(
+        {},                                        //csrDependencies
+        &timestampPacketDependencies.barrierNodes, //barrierTimestampPacketNodes
+        {},                                        //pipelineSelectArgs
+        this->flushStamp->getStampReference(),     //flushStampReference
+        getThrottle(),                             //throttle
+        commandList.getPreemptionMode(),           //preemptionMode
+        numGrfRequired,                            //numGrfRequired
+        L3CachingSettings::l3CacheOn,              //l3CacheSettings
+        threadArbitrationPolicy,                   //threadArbitrationPolicy
+        getSliceCount(),                           //sliceCount
+        false,                                     //blocking
+        true,                                      //dcFlush
+        useSlm,                                    //useSLM
+        true,                                      //guardCommandBufferWithPipeControl
+        true,                                      //GSBA32BitRequired
+        requiresCoherency,                         //requiresCoherency
+        (QueuePriority::LOW == priority),          //lowPriority
+        false,                                     //implicitFlush
+        false,                                     //outOfOrderExecutionAllowed
+        false                                      //epilogueRequired
+    );
+
+    dispatchFlags.pipelineSelectArgs.specialPipelineSelectMode = specialPipelineSelectMode;
+
+    if (timestampPacketWriteEnabled) {
+        dispatchFlags.csrDependencies.fillFromEventsRequest(eventsRequest, commandStreamReceiver, CsrDependencies::DependenciesType::OutOfCsr);
+        dispatchFlags.csrDependencies.makeResident(commandStreamReceiver);
+    }
+
+    if (anyUncacheableArgs) {
+        dispatchFlags.l3CacheSettings = L3CachingSettings::l3CacheOff;
+    } else if (!anyStatelessWrites) {
+        dispatchFlags.l3CacheSettings = L3CachingSettings::l3AndL1On;
+    }
+
+    if (this->dispatchHints != 0) {
+        dispatchFlags.engineHints = this->dispatchHints;
+        dispatchFlags.epilogueRequired = true;
+    }
+
+    CompletionStamp completionStamp = commandStreamReceiver.flushTask(
+        commandStream,
+        commandStreamStart,
+        *commandContainer.getIndirectHeap(IndirectHeap::DYNAMIC_STATE),
+        *commandContainer.getIndirectHeap(IndirectHeap::INDIRECT_OBJECT),
+        *commandContainer.getIndirectHeap(IndirectHeap::SURFACE_STATE),
+        taskLevel,
+        dispatchFlags,
+        *device);
+
+    updateFromCompletionStamp(completionStamp);
+    commandList.updateLastSubmission(completionStamp.taskCount, completionStamp.flushStamp);
+
+    if (eventBuilder.getEvent()) {
+        eventBuilder.getEvent()->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        eventBuilder.getEvent()->updateCompletionStamp(completionStamp.taskCount, completionStamp.taskLevel, completionStamp.flushStamp);
+    }
+
+    return CL_SUCCESS;
+}
+} // namespace NEO
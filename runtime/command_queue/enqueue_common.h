@@ -33,6 +33,7 @@
 #include "runtime/os_interface/os_context.h"
 #include "runtime/program/block_kernel_manager.h"
 #include "runtime/program/printf_handler.h"
+#include "runtime/utilities/enqueue_phase_profiler.h"
 #include "runtime/utilities/tag_allocator.h"
 
 #include <algorithm>
@@ -53,21 +54,45 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
                                                cl_uint numEventsInWaitList,
                                                const cl_event *eventWaitList,
                                                cl_event *event) {
+    std::unique_lock<CommandStreamReceiver::MutexType> commandStreamReceiverOwnership;
     BuiltInOwnershipWrapper builtInLock;
     MemObjsForAuxTranslation memObjsForAuxTranslation;
+    MemObjsForAuxTranslation memObjsToTranslate;
+    MemObjsForAuxTranslation memObjsInNonAuxState;
     MultiDispatchInfo multiDispatchInfo(kernel);
+    bool deferAuxTranslation = false;
 
     if (DebugManager.flags.ForceDispatchScheduler.get()) {
         forceDispatchScheduler(multiDispatchInfo);
     } else {
+        if (kernel->isAuxTranslationRequired() || !deferredAuxTranslations.empty()) {
+            // csr before builtin ownership, same order as in restoreDeferredAuxTranslations
+            commandStreamReceiverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+            if (kernel->isAuxTranslationRequired()) {
+                kernel->fillWithBuffersForAuxTranslation(memObjsForAuxTranslation);
+            }
+            // buffer left in non-aux state by this or another queue is taken over by this kernel
+            for (auto memObj : memObjsForAuxTranslation) {
+                if (memObj->takeDeferredAuxTranslation()) {
+                    memObjsInNonAuxState.insert(memObj);
+                }
+            }
+            restoreDeferredAuxTranslations();
+        }
+
         if (kernel->isAuxTranslationRequired()) {
             auto &builder = getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::AuxTranslation, getContext(), getDevice());
             builtInLock.takeOwnership(builder, this->context);
-            kernel->fillWithBuffersForAuxTranslation(memObjsForAuxTranslation);
-            multiDispatchInfo.setMemObjsForAuxTranslation(memObjsForAuxTranslation);
-            if (!memObjsForAuxTranslation.empty()) {
+            for (auto memObj : memObjsForAuxTranslation) {
+                if (memObjsInNonAuxState.find(memObj) == memObjsInNonAuxState.end()) {
+                    memObjsToTranslate.insert(memObj);
+                }
+            }
+            multiDispatchInfo.setMemObjsForAuxTranslation(memObjsToTranslate);
+            if (!memObjsToTranslate.empty()) {
                 dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::AuxToNonAux);
             }
+            auxTranslationStatistics.translationsAvoided += 2 * memObjsInNonAuxState.size();
         }
 
         if (kernel->getKernelInfo().builtinDispatchBuilder == nullptr) {
@@ -80,13 +105,18 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
             builder->buildDispatchInfos(multiDispatchInfo, kernel, workDim, workItems, enqueuedWorkSizes, globalOffsets);
 
             if (multiDispatchInfo.size() == 0) {
+                deferAuxTranslations(memObjsInNonAuxState);
                 return;
             }
         }
         if (kernel->isAuxTranslationRequired()) {
+            multiDispatchInfo.setMemObjsForAuxTranslation(memObjsForAuxTranslation);
             if (!memObjsForAuxTranslation.empty()) {
                 UNRECOVERABLE_IF(kernel->isParentKernel);
-                dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
+                deferAuxTranslation = isAuxTranslationDeferralAllowed(blocking, event);
+                if (!deferAuxTranslation) {
+                    dispatchAuxTranslationBuiltin(multiDispatchInfo, AuxTranslationDirection::NonAuxToAux);
+                }
             }
         }
     }
@@ -96,6 +126,10 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
     }
 
     enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+
+    if (deferAuxTranslation) {
+        deferAuxTranslations(memObjsForAuxTranslation);
+    }
 }
 
 template <typename GfxFamily>
@@ -151,13 +185,17 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
 
+    if (!deferredAuxTranslations.empty()) {
+        restoreDeferredAuxTranslations();
+    }
+
     TimeStampData queueTimeStamp;
     if (isProfilingEnabled() && event) {
         this->getDevice().getOSTime()->getCpuGpuTime(&queueTimeStamp);
     }
     EventBuilder eventBuilder;
     if (event) {
-        eventBuilder.create<Event>(this, commandType, Event::eventNotReady, 0);
+        eventBuilder.createFromPool<Event>(getObjectPool(), this, commandType, Event::eventNotReady, 0);
         *event = eventBuilder.getEvent();
         if (eventBuilder.getEvent()->isProfilingEnabled()) {
             eventBuilder.getEvent()->setQueueTimeStamp(&queueTimeStamp);
@@ -390,6 +428,7 @@ void CommandQueueHw<GfxFamily>::processDispatchForKernels(const MultiDispatchInf
                                                           CsrDependencies &csrDeps,
                                                           KernelOperation *blockedCommandsData,
                                                           TimestampPacketDependencies &timestampPacketDependencies) {
+    EnqueuePhaseScope phaseScope(EnqueuePhase::ProcessDispatchForKernels);
     TagNode<HwPerfCounter> *hwPerfCounter = nullptr;
     FileLoggerInstance().dumpKernelArgs(&multiDispatchInfo);
 
@@ -578,6 +617,7 @@ void CommandQueueHw<GfxFamily>::processDeviceEnqueue(DeviceQueueHw<GfxFamily> *d
 
 template <typename GfxFamily>
 void CommandQueueHw<GfxFamily>::obtainTaskLevelAndBlockedStatus(unsigned int &taskLevel, cl_uint &numEventsInWaitList, const cl_event *&eventWaitList, bool &blockQueueStatus, unsigned int commandType) {
+    EnqueuePhaseScope phaseScope(EnqueuePhase::ObtainTaskLevelAndBlockedStatus);
     auto isQueueBlockedStatus = isQueueBlocked();
     taskLevel = getTaskLevelFromWaitList(this->taskLevel, numEventsInWaitList, eventWaitList);
     blockQueueStatus = (taskLevel == Event::eventNotReady) || isQueueBlockedStatus;
@@ -820,7 +860,7 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
         DBG_LOG(EventsDebugEnable, "enqueueBlocked", "output event as virtualEvent", virtualEvent);
     } else {
         // it will be an internal event
-        internalEventBuilder.create<VirtualEvent>(this, context);
+        internalEventBuilder.createFromPool<VirtualEvent>(getObjectPool(), this, context);
         eventBuilder = &internalEventBuilder;
         DBG_LOG(EventsDebugEnable, "enqueueBlocked", "new virtualEvent", eventBuilder->getEvent());
     }
@@ -842,7 +882,7 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
     }
 
     if (enqueueProperties.operation != EnqueueProperties::Operation::GpuKernel) {
-        command = std::make_unique<CommandWithoutKernel>(*this, blockedCommandsData);
+        command.reset(new (getObjectPool()) CommandWithoutKernel(*this, blockedCommandsData));
     } else {
         //store task data in event
         std::vector<Surface *> allSurfaces;
@@ -861,16 +901,16 @@ void CommandQueueHw<GfxFamily>::enqueueBlocked(
 
         PreemptionMode preemptionMode = PreemptionHelper::taskPreemptionMode(*device, multiDispatchInfo);
         bool slmUsed = multiDispatchInfo.usesSlm() || multiDispatchInfo.peekParentKernel();
-        command = std::make_unique<CommandComputeKernel>(*this,
-                                                         blockedCommandsData,
-                                                         allSurfaces,
-                                                         shouldFlushDC(commandType, printfHandler.get()),
-                                                         slmUsed,
-                                                         commandType == CL_COMMAND_NDRANGE_KERNEL,
-                                                         std::move(printfHandler),
-                                                         preemptionMode,
-                                                         multiDispatchInfo.peekMainKernel(),
-                                                         (uint32_t)multiDispatchInfo.size());
+        command.reset(new (getObjectPool()) CommandComputeKernel(*this,
+                                                                 blockedCommandsData,
+                                                                 allSurfaces,
+                                                                 shouldFlushDC(commandType, printfHandler.get()),
+                                                                 slmUsed,
+                                                                 commandType == CL_COMMAND_NDRANGE_KERNEL,
+                                                                 std::move(printfHandler),
+                                                                 preemptionMode,
+                                                                 multiDispatchInfo.peekMainKernel(),
+                                                                 (uint32_t)multiDispatchInfo.size()));
     }
     if (storeTimestampPackets) {
         for (cl_uint i = 0; i < eventsRequest.numEventsInWaitList; i++) {
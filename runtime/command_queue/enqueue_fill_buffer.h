@@ -32,18 +32,6 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     auto memoryManager = getDevice().getMemoryManager();
     DEBUG_BREAK_IF(nullptr == memoryManager);
 
-    auto patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), alignUp(patternSize, MemoryConstants::cacheLineSize), GraphicsAllocation::AllocationType::FILL_PATTERN});
-
-    if (patternSize == 1) {
-        int patternInt = (uint32_t)((*(uint8_t *)pattern << 24) | (*(uint8_t *)pattern << 16) | (*(uint8_t *)pattern << 8) | *(uint8_t *)pattern);
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(int), &patternInt, sizeof(int));
-    } else if (patternSize == 2) {
-        int patternInt = (uint32_t)((*(uint16_t *)pattern << 16) | *(uint16_t *)pattern);
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(int), &patternInt, sizeof(int));
-    } else {
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), patternSize, pattern, patternSize);
-    }
-
     auto eBuiltInOps = EBuiltInOps::FillBuffer;
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::FillBufferStateless;
@@ -56,17 +44,52 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
     BuiltinOpParams dc;
-    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
-                         patternAllocation->getUnderlyingBuffer(), patternAllocation, false, false, true);
-    dc.srcMemObj = &patternMemObj;
     dc.dstMemObj = buffer;
     dc.dstOffset = {offset, 0, 0};
     dc.size = {size, 0, 0};
 
     MultiDispatchInfo dispatchInfo;
+    MemObjSurface s1(buffer);
+
+    if (isFillPatternImmediate(patternSize)) {
+        uint32_t immediatePattern[maxImmediateFillPatternSize / sizeof(uint32_t)] = {};
+        BuiltinOpParams immediateParams = dc;
+        immediateParams.srcPtr = immediatePattern;
+        immediateParams.patternSize = copyFillPattern(immediatePattern, pattern, patternSize);
+
+        // builtins without the immediate kernels fall through to the pattern allocation
+        if (builder.buildDispatchInfos(dispatchInfo, immediateParams)) {
+            Surface *surfaces[] = {&s1};
+            enqueueHandler<CL_COMMAND_FILL_BUFFER>(
+                surfaces,
+                false,
+                dispatchInfo,
+                numEventsInWaitList,
+                eventWaitList,
+                event);
+
+            return CL_SUCCESS;
+        }
+    }
+
+    auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
+    auto allocationType = GraphicsAllocation::AllocationType::FILL_PATTERN;
+    auto patternAllocationSize = alignUp(patternSize, MemoryConstants::cacheLineSize);
+    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(patternAllocationSize, allocationType).release();
+    commandStreamReceieverOwnership.unlock();
+
+    if (!patternAllocation) {
+        patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), patternAllocationSize, allocationType});
+    }
+
+    copyFillPattern(patternAllocation->getUnderlyingBuffer(), pattern, patternSize);
+
+    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), patternAllocation, false, false, true);
+    dc.srcMemObj = &patternMemObj;
     builder.buildDispatchInfos(dispatchInfo, dc);
 
-    MemObjSurface s1(buffer);
     GeneralSurface s2(patternAllocation);
     Surface *surfaces[] = {&s1, &s2};
 
@@ -78,8 +101,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
         eventWaitList,
         event);
 
-    auto storageForAllocation = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
-    storageForAllocation->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(patternAllocation), TEMPORARY_ALLOCATION, taskCount);
+    storageWithAllocations->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(patternAllocation), REUSABLE_ALLOCATION, taskCount);
 
     return CL_SUCCESS;
 }
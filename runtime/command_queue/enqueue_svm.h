@@ -449,26 +449,6 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemFill(void *svmPtr,
         pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(svmData->gpuAllocation->getGpuAddress()));
     }
 
-    auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
-    auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
-    auto allocationType = GraphicsAllocation::AllocationType::FILL_PATTERN;
-    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(patternSize, allocationType).release();
-    commandStreamReceieverOwnership.unlock();
-
-    if (!patternAllocation) {
-        patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), patternSize, allocationType});
-    }
-
-    if (patternSize == 1) {
-        int patternInt = (uint32_t)((*(uint8_t *)pattern << 24) | (*(uint8_t *)pattern << 16) | (*(uint8_t *)pattern << 8) | *(uint8_t *)pattern);
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(int), &patternInt, sizeof(int));
-    } else if (patternSize == 2) {
-        int patternInt = (uint32_t)((*(uint16_t *)pattern << 16) | *(uint16_t *)pattern);
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(int), &patternInt, sizeof(int));
-    } else {
-        memcpy_s(patternAllocation->getUnderlyingBuffer(), patternSize, pattern, patternSize);
-    }
-
     auto builtInType = EBuiltInOps::FillBuffer;
     if (forceStateless(svmData->size)) {
         builtInType = EBuiltInOps::FillBufferStateless;
@@ -480,23 +460,56 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemFill(void *svmPtr,
 
     BuiltInOwnershipWrapper builtInLock(builder, this->context);
 
-    BuiltinOpParams operationParams;
-    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
-                         patternAllocation->getUnderlyingBuffer(), patternAllocation, false, false, true);
-
     void *alignedDstPtr = alignDown(svmPtr, 4);
     size_t dstPtrOffset = ptrDiff(svmPtr, alignedDstPtr);
 
-    operationParams.srcMemObj = &patternMemObj;
+    BuiltinOpParams operationParams;
     operationParams.dstPtr = alignedDstPtr;
     operationParams.dstSvmAlloc = svmData->gpuAllocation;
     operationParams.dstOffset = {dstPtrOffset, 0, 0};
     operationParams.size = {size, 0, 0};
 
     MultiDispatchInfo dispatchInfo;
+    GeneralSurface s1(svmData->gpuAllocation);
+
+    if (isFillPatternImmediate(patternSize)) {
+        uint32_t immediatePattern[maxImmediateFillPatternSize / sizeof(uint32_t)] = {};
+        BuiltinOpParams immediateParams = operationParams;
+        immediateParams.srcPtr = immediatePattern;
+        immediateParams.patternSize = copyFillPattern(immediatePattern, pattern, patternSize);
+
+        // builtins without the immediate kernels fall through to the pattern allocation
+        if (builder.buildDispatchInfos(dispatchInfo, immediateParams)) {
+            Surface *surfaces[] = {&s1};
+            enqueueHandler<CL_COMMAND_SVM_MEMFILL>(
+                surfaces,
+                false,
+                dispatchInfo,
+                numEventsInWaitList,
+                eventWaitList,
+                event);
+
+            return CL_SUCCESS;
+        }
+    }
+
+    auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
+    auto allocationType = GraphicsAllocation::AllocationType::FILL_PATTERN;
+    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(patternSize, allocationType).release();
+    commandStreamReceieverOwnership.unlock();
+
+    if (!patternAllocation) {
+        patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), patternSize, allocationType});
+    }
+
+    copyFillPattern(patternAllocation->getUnderlyingBuffer(), pattern, patternSize);
+
+    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), patternAllocation, false, false, true);
+    operationParams.srcMemObj = &patternMemObj;
     builder.buildDispatchInfos(dispatchInfo, operationParams);
 
-    GeneralSurface s1(svmData->gpuAllocation);
     GeneralSurface s2(patternAllocation);
     Surface *surfaces[] = {&s1, &s2};
 
@@ -13,6 +13,8 @@ namespace NEO {
 
 template <typename GfxFamily>
 cl_int CommandQueueHw<GfxFamily>::finish() {
+    restoreDeferredAuxTranslations();
+
     auto result = getGpgpuCommandStreamReceiver().flushBatchedSubmissions();
     if (!result) {
         return CL_OUT_OF_RESOURCES;
@@ -46,6 +46,22 @@ class HardwareInterface {
         TimestampPacketContainer *currentTimestampPacketNodes,
         uint32_t commandType);
 
+    static void dispatchWalker(
+        CommandQueue &commandQueue,
+        const MultiDispatchInfo &multiDispatchInfo,
+        const CsrDependencies &csrDependencies,
+        LinearStream &commandStream,
+        IndirectHeap &dsh,
+        IndirectHeap &ioh,
+        IndirectHeap &ssh,
+        TagNode<HwTimeStamps> *hwTimeStamps,
+        TagNode<HwPerfCounter> *hwPerfCounter,
+        TimestampPacketDependencies *timestampPacketDependencies,
+        TimestampPacketContainer *currentTimestampPacketNodes,
+        uint32_t commandType);
+
+    static void setLocalWorkgroupSizes(const MultiDispatchInfo &multiDispatchInfo);
+
     static void getDefaultDshSpace(
         const size_t &offsetInterfaceDescriptorTable,
         CommandQueue &commandQueue,
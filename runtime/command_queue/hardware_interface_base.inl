@@ -36,17 +36,8 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
     LinearStream *commandStream = nullptr;
     IndirectHeap *dsh = nullptr, *ioh = nullptr, *ssh = nullptr;
-    auto parentKernel = multiDispatchInfo.peekParentKernel();
-    auto mainKernel = multiDispatchInfo.peekMainKernel();
-    auto preemptionMode = PreemptionHelper::taskPreemptionMode(commandQueue.getDevice(), multiDispatchInfo);
 
-    for (auto &dispatchInfo : multiDispatchInfo) {
-        // Compute local workgroup sizes
-        if (dispatchInfo.getLocalWorkgroupSize().x == 0) {
-            const auto lws = generateWorkgroupSize(dispatchInfo);
-            const_cast<DispatchInfo &>(dispatchInfo).setLWS(lws);
-        }
-    }
+    setLocalWorkgroupSizes(multiDispatchInfo);
 
     // Allocate command stream and indirect heaps
     bool blockedQueue = (blockedCommandsData != nullptr);
@@ -58,49 +49,72 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
         commandStream = &commandQueue.getCS(0);
     }
 
-    TimestampPacketHelper::programCsrDependencies<GfxFamily>(*commandStream, csrDependencies);
+    dispatchWalker(commandQueue, multiDispatchInfo, csrDependencies, *commandStream, *dsh, *ioh, *ssh,
+                   hwTimeStamps, hwPerfCounter, timestampPacketDependencies, currentTimestampPacketNodes, commandType);
+}
 
-    dsh->align(HardwareCommandsHelper<GfxFamily>::alignInterfaceDescriptorData);
+template <typename GfxFamily>
+void HardwareInterface<GfxFamily>::dispatchWalker(
+    CommandQueue &commandQueue,
+    const MultiDispatchInfo &multiDispatchInfo,
+    const CsrDependencies &csrDependencies,
+    LinearStream &commandStream,
+    IndirectHeap &dsh,
+    IndirectHeap &ioh,
+    IndirectHeap &ssh,
+    TagNode<HwTimeStamps> *hwTimeStamps,
+    TagNode<HwPerfCounter> *hwPerfCounter,
+    TimestampPacketDependencies *timestampPacketDependencies,
+    TimestampPacketContainer *currentTimestampPacketNodes,
+    uint32_t commandType) {
+
+    auto parentKernel = multiDispatchInfo.peekParentKernel();
+    auto mainKernel = multiDispatchInfo.peekMainKernel();
+    auto preemptionMode = PreemptionHelper::taskPreemptionMode(commandQueue.getDevice(), multiDispatchInfo);
+
+    TimestampPacketHelper::programCsrDependencies<GfxFamily>(commandStream, csrDependencies);
+
+    dsh.align(HardwareCommandsHelper<GfxFamily>::alignInterfaceDescriptorData);
 
     uint32_t interfaceDescriptorIndex = 0;
-    const size_t offsetInterfaceDescriptorTable = dsh->getUsed();
+    const size_t offsetInterfaceDescriptorTable = dsh.getUsed();
 
     size_t totalInterfaceDescriptorTableSize = sizeof(INTERFACE_DESCRIPTOR_DATA);
 
     getDefaultDshSpace(offsetInterfaceDescriptorTable, commandQueue, multiDispatchInfo, totalInterfaceDescriptorTableSize,
-                       parentKernel, dsh, commandStream);
+                       parentKernel, &dsh, &commandStream);
 
     // Program media interface descriptor load
     HardwareCommandsHelper<GfxFamily>::sendMediaInterfaceDescriptorLoad(
-        *commandStream,
+        commandStream,
         offsetInterfaceDescriptorTable,
         totalInterfaceDescriptorTableSize);
 
     DEBUG_BREAK_IF(offsetInterfaceDescriptorTable % 64 != 0);
 
-    dispatchProfilingPerfStartCommands(hwTimeStamps, hwPerfCounter, commandStream, commandQueue);
+    dispatchProfilingPerfStartCommands(hwTimeStamps, hwPerfCounter, &commandStream, commandQueue);
 
     size_t currentDispatchIndex = 0;
     for (auto &dispatchInfo : multiDispatchInfo) {
-        dispatchInfo.dispatchInitCommands(*commandStream, timestampPacketDependencies);
+        dispatchInfo.dispatchInitCommands(commandStream, timestampPacketDependencies);
         bool isMainKernel = (dispatchInfo.getKernel() == mainKernel);
 
-        dispatchKernelCommands(commandQueue, dispatchInfo, commandType, *commandStream, isMainKernel,
+        dispatchKernelCommands(commandQueue, dispatchInfo, commandType, commandStream, isMainKernel,
                                currentDispatchIndex, currentTimestampPacketNodes, preemptionMode, interfaceDescriptorIndex,
-                               offsetInterfaceDescriptorTable, *dsh, *ioh, *ssh);
+                               offsetInterfaceDescriptorTable, dsh, ioh, ssh);
 
         currentDispatchIndex++;
-        dispatchInfo.dispatchEpilogueCommands(*commandStream, timestampPacketDependencies);
+        dispatchInfo.dispatchEpilogueCommands(commandStream, timestampPacketDependencies);
     }
     if (mainKernel->requiresCacheFlushCommand(commandQueue)) {
         uint64_t postSyncAddress = 0;
-        if (commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+        if (currentTimestampPacketNodes && commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
             auto timestampPacketNodeForPostSync = currentTimestampPacketNodes->peekNodes().at(currentDispatchIndex);
             postSyncAddress = timestampPacketNodeForPostSync->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd);
         }
-        HardwareCommandsHelper<GfxFamily>::programCacheFlushAfterWalkerCommand(commandStream, commandQueue, mainKernel, postSyncAddress);
+        HardwareCommandsHelper<GfxFamily>::programCacheFlushAfterWalkerCommand(&commandStream, commandQueue, mainKernel, postSyncAddress);
     }
-    dispatchProfilingPerfEndCommands(hwTimeStamps, hwPerfCounter, commandStream, commandQueue);
+    dispatchProfilingPerfEndCommands(hwTimeStamps, hwPerfCounter, &commandStream, commandQueue);
 }
 
 template <typename GfxFamily>
@@ -175,7 +189,7 @@ void HardwareInterface<GfxFamily>::dispatchKernelCommands(CommandQueue &commandQ
 
     dispatchWorkarounds(&commandStream, commandQueue, kernel, true);
 
-    if (commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+    if (currentTimestampPacketNodes && commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         auto timestampPacketNode = currentTimestampPacketNodes->peekNodes().at(currentDispatchIndex);
         GpgpuWalkerHelper<GfxFamily>::setupTimestampPacket(&commandStream, nullptr, timestampPacketNode, TimestampPacketStorage::WriteOperationType::BeforeWalker, commandQueue.getDevice().getHardwareInfo());
     }
@@ -187,6 +201,17 @@ void HardwareInterface<GfxFamily>::dispatchKernelCommands(CommandQueue &commandQ
     dispatchWorkarounds(&commandStream, commandQueue, kernel, false);
 }
 
+template <typename GfxFamily>
+void HardwareInterface<GfxFamily>::setLocalWorkgroupSizes(const MultiDispatchInfo &multiDispatchInfo) {
+    for (auto &dispatchInfo : multiDispatchInfo) {
+        // Compute local workgroup sizes
+        if (dispatchInfo.getLocalWorkgroupSize().x == 0) {
+            const auto lws = generateWorkgroupSize(dispatchInfo);
+            const_cast<DispatchInfo &>(dispatchInfo).setLWS(lws);
+        }
+    }
+}
+
 template <typename GfxFamily>
 void HardwareInterface<GfxFamily>::obtainIndirectHeaps(CommandQueue &commandQueue, const MultiDispatchInfo &multiDispatchInfo,
                                                        bool blockedQueue, IndirectHeap *&dsh, IndirectHeap *&ioh, IndirectHeap *&ssh) {
@@ -48,6 +48,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
         indirectHeap[i] = nullptr;
     }
     internalAllocationStorage = std::make_unique<InternalAllocationStorage>(*this);
+    completionWaitPolicy = std::make_unique<CompletionWaitPolicy>();
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
@@ -62,6 +63,7 @@ CommandStreamReceiver::~CommandStreamReceiver() {
     }
     cleanupResources();
 
+    internalAllocationStorage->releaseHostPtrAllocations();
     internalAllocationStorage->cleanAllocationList(-1, REUSABLE_ALLOCATION);
     internalAllocationStorage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
     getMemoryManager()->unregisterEngineForCsr(this);
@@ -187,9 +189,6 @@ void CommandStreamReceiver::cleanupResources() {
 }
 
 bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) {
-    std::chrono::high_resolution_clock::time_point time1, time2;
-    int64_t timeDiff = 0;
-
     uint32_t latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
         if (!this->flushBatchedSubmissions()) {
@@ -197,17 +196,7 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
         }
     }
 
-    time1 = std::chrono::high_resolution_clock::now();
-    while (*getTagAddress() < taskCountToWait && timeDiff <= timeoutMicroseconds) {
-        std::this_thread::yield();
-        _mm_pause();
-
-        if (enableTimeout) {
-            time2 = std::chrono::high_resolution_clock::now();
-            timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
-        }
-    }
-    if (*getTagAddress() >= taskCountToWait) {
+    if (completionWaitPolicy->waitForCompletion(getTagAddress(), taskCountToWait, enableTimeout, timeoutMicroseconds)) {
         if (gtpinIsGTPinInitialized()) {
             gtpinNotifyTaskCompletion(taskCountToWait);
         }
@@ -392,6 +381,18 @@ AllocationsList &CommandStreamReceiver::getTemporaryAllocations() { return inter
 AllocationsList &CommandStreamReceiver::getAllocationsForReuse() { return internalAllocationStorage->getAllocationsForReuse(); }
 
 bool CommandStreamReceiver::createAllocationForHostSurface(HostPtrSurface &surface, bool requiresL3Flush) {
+    auto hostPtrAllocationCacheBudget = getHostPtrAllocationCacheBudget();
+    if (hostPtrAllocationCacheBudget > 0) {
+        auto cachedAllocation = internalAllocationStorage->obtainHostPtrAllocation(surface.getMemoryPointer(), surface.getSurfaceSize());
+        if (cachedAllocation) {
+            if (requiresL3Flush) {
+                cachedAllocation->setFlushL3Required(true);
+            }
+            surface.setAllocation(cachedAllocation);
+            return true;
+        }
+    }
+
     auto memoryManager = getMemoryManager();
     AllocationProperties properties{rootDeviceIndex, false, surface.getSurfaceSize(), GraphicsAllocation::AllocationType::EXTERNAL_HOST_PTR, false};
     properties.flags.flushL3RequiredForRead = properties.flags.flushL3RequiredForWrite = requiresL3Flush;
@@ -410,10 +411,23 @@ bool CommandStreamReceiver::createAllocationForHostSurface(HostPtrSurface &surfa
     }
     allocation->updateTaskCount(Event::eventNotReady, osContext->getContextId());
     surface.setAllocation(allocation);
-    internalAllocationStorage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+    if (hostPtrAllocationCacheBudget > 0 && allocation->getAllocationType() == GraphicsAllocation::AllocationType::EXTERNAL_HOST_PTR) {
+        internalAllocationStorage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(allocation), hostPtrAllocationCacheBudget);
+    } else {
+        internalAllocationStorage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+    }
     return true;
 }
 
+size_t CommandStreamReceiver::getHostPtrAllocationCacheBudget() const {
+    // cached allocations are keyed by address only, so the cache is opt-in: freeing or unmapping
+    // cached host memory without clReleaseHostPtrAllocationsINTEL leaves a stale allocation behind
+    if (DebugManager.flags.HostPtrAllocationCacheBudgetInKB.get() > 0) {
+        return static_cast<size_t>(DebugManager.flags.HostPtrAllocationCacheBudgetInKB.get() * MemoryConstants::kiloByte);
+    }
+    return 0u;
+}
+
 TagAllocator<HwTimeStamps> *CommandStreamReceiver::getEventTsAllocator() {
     if (profilingTimeStampAllocator.get() == nullptr) {
         profilingTimeStampAllocator = std::make_unique<TagAllocator<HwTimeStamps>>(
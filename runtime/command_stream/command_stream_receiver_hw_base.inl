@@ -32,6 +32,7 @@
 #include "runtime/memory_manager/internal_allocation_storage.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/os_context.h"
+#include "runtime/utilities/enqueue_phase_profiler.h"
 #include "runtime/utilities/tag_allocator.h"
 
 #include "command_stream_receiver_hw_ext.inl"
@@ -59,6 +60,7 @@ CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiverHw(ExecutionEnvironment
 
 template <typename GfxFamily>
 bool CommandStreamReceiverHw<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    EnqueuePhaseScope phaseScope(EnqueuePhase::Flush);
     return true;
 }
 
@@ -143,6 +145,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     typedef typename GfxFamily::MI_BATCH_BUFFER_END MI_BATCH_BUFFER_END;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     typedef typename GfxFamily::STATE_BASE_ADDRESS STATE_BASE_ADDRESS;
+    EnqueuePhaseScope phaseScope(EnqueuePhase::FlushTask);
 
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
@@ -322,6 +325,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             getMemoryManager()->getInternalHeapBaseAddress(rootDeviceIndex),
             device.getGmmHelper(),
             isMultiOsContextCapable());
+        stateProgrammingCounters.stateBaseAddress++;
 
         if (sshDirty) {
             bindingTableBaseAddressRequired = true;
@@ -732,6 +736,7 @@ template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programPreamble(LinearStream &csr, Device &device, DispatchFlags &dispatchFlags, uint32_t &newL3Config) {
     if (!this->isPreambleSent) {
         PreambleHelper<GfxFamily>::programPreamble(&csr, device, newL3Config, this->requiredThreadArbitrationPolicy, this->preemptionAllocation, this->perDssBackedBuffer);
+        stateProgrammingCounters.preamble++;
         this->isPreambleSent = true;
         this->lastSentL3Config = newL3Config;
         this->lastSentThreadArbitrationPolicy = this->requiredThreadArbitrationPolicy;
@@ -745,6 +750,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::programVFEState(LinearStream &cs
         if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
             flatBatchBufferHelper->collectScratchSpacePatchInfo(getScratchPatchAddress(), commandOffset, csr);
         }
+        stateProgrammingCounters.mediaVfeState++;
         setMediaVFEStateDirty(false);
     }
 }
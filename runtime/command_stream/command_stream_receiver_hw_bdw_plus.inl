@@ -26,6 +26,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::programL3(LinearStream &csr, Dis
         addClearSLMWorkAround(pCmd);
 
         PreambleHelper<GfxFamily>::programL3(&csr, newL3Config);
+        stateProgrammingCounters.l3Config++;
         this->lastSentL3Config = newL3Config;
     }
 }
@@ -49,6 +50,7 @@ template <typename GfxFamily>
 void CommandStreamReceiverHw<GfxFamily>::programPipelineSelect(LinearStream &commandStream, PipelineSelectArgs &pipelineSelectArgs) {
     if (csrSizeRequestFlags.mediaSamplerConfigChanged || !isPreambleSent) {
         PreambleHelper<GfxFamily>::programPipelineSelect(&commandStream, pipelineSelectArgs, peekHwInfo());
+        stateProgrammingCounters.pipelineSelect++;
         this->lastMediaSamplerConfig = pipelineSelectArgs.mediaSamplerRequired;
     }
 }
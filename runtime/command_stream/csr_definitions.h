@@ -102,4 +102,12 @@ struct CsrSizeRequestFlags {
     bool numGrfRequiredChanged = false;
     bool specialPipelineSelectModeChanged = false;
 };
+
+struct StateProgrammingCounters {
+    uint32_t preamble = 0u;
+    uint32_t l3Config = 0u;
+    uint32_t pipelineSelect = 0u;
+    uint32_t mediaVfeState = 0u;
+    uint32_t stateBaseAddress = 0u;
+};
 } // namespace NEO
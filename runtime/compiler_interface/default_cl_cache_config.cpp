@@ -7,15 +7,20 @@
 
 #include "default_cl_cache_config.h"
 
+#include "core/memory_manager/memory_constants.h"
 #include "core/utilities/debug_settings_reader.h"
 #include "runtime/os_interface/ocl_reg_path.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
 #include <string>
 
 namespace NEO {
+// both limits are off unless set, disk cache stays unbounded as before
+constexpr int32_t defaultClCacheMaxSizeInMb = 0;
+constexpr int32_t defaultClCacheMemorySizeInMb = 0;
 
 CompilerCacheConfig getDefaultClCompilerCacheConfig() {
     CompilerCacheConfig ret;
@@ -27,6 +32,16 @@ CompilerCacheConfig getDefaultClCompilerCacheConfig() {
 
     ret.cacheFileExtension = ".cl_cache";
 
+    std::string sizeKeyName = oclRegPath;
+    sizeKeyName += "cl_cache_max_size_mb";
+    auto cacheSizeInMb = settingsReader->getSetting(settingsReader->appSpecificLocation(sizeKeyName), defaultClCacheMaxSizeInMb);
+    ret.cacheSize = static_cast<size_t>(std::max(cacheSizeInMb, 0)) * MemoryConstants::megaByte;
+
+    std::string memorySizeKeyName = oclRegPath;
+    memorySizeKeyName += "cl_cache_memory_size_mb";
+    auto memoryCacheSizeInMb = settingsReader->getSetting(settingsReader->appSpecificLocation(memorySizeKeyName), defaultClCacheMemorySizeInMb);
+    ret.memoryCacheSize = static_cast<size_t>(std::max(memoryCacheSizeInMb, 0)) * MemoryConstants::megaByte;
+
     return ret;
 }
 
@@ -26,6 +26,7 @@
 #include "runtime/platform/platform.h"
 #include "runtime/sharings/sharing.h"
 #include "runtime/sharings/sharing_factory.h"
+#include "runtime/utilities/object_pool.h"
 
 #include "d3d_sharing_functions.h"
 
@@ -46,6 +47,8 @@ Context::Context(
     defaultDeviceQueue = nullptr;
     driverDiagnostics = nullptr;
     sharingFunctions.resize(SharingType::MAX_SHARING_VALUE);
+    objectPool = new ObjectPool();
+    objectPool->incRefInternal();
 }
 
 Context::~Context() {
@@ -59,6 +62,8 @@ Context::~Context() {
     if (driverDiagnostics) {
         delete driverDiagnostics;
     }
+    // objects still allocated from the pool keep it alive
+    objectPool->decRefInternal();
     if (memoryManager && memoryManager->isAsyncDeleterEnabled()) {
         memoryManager->getDeferredDeleter()->removeClient();
     }
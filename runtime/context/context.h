@@ -22,6 +22,7 @@ class Device;
 class DeviceQueue;
 class MemObj;
 class MemoryManager;
+class ObjectPool;
 class SharingFunctions;
 class SVMAllocsManager;
 
@@ -85,6 +86,10 @@ class Context : public BaseObject<_cl_context> {
         return svmAllocsManager;
     }
 
+    ObjectPool *getObjectPool() const {
+        return objectPool;
+    }
+
     DeviceQueue *getDefaultDeviceQueue();
     void setDefaultDeviceQueue(DeviceQueue *queue);
 
@@ -153,6 +158,7 @@ class Context : public BaseObject<_cl_context> {
     DeviceVector devices;
     MemoryManager *memoryManager;
     SVMAllocsManager *svmAllocsManager = nullptr;
+    ObjectPool *objectPool = nullptr;
     CommandQueue *specialQueue;
     DeviceQueue *defaultDeviceQueue;
     std::vector<std::unique_ptr<SharingFunctions>> sharingFunctions;
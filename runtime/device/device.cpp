@@ -8,6 +8,7 @@
 #include "runtime/device/device.h"
 
 #include "core/command_stream/preemption.h"
+#include "core/helpers/debug_helpers.h"
 #include "core/helpers/hw_helper.h"
 #include "core/program/sync_buffer_handler.h"
 #include "runtime/command_stream/command_stream_receiver.h"
@@ -21,6 +22,9 @@
 #include "runtime/os_interface/os_time.h"
 #include "runtime/source_level_debugger/source_level_debugger.h"
 
+#include <chrono>
+#include <thread>
+
 namespace NEO {
 
 decltype(&PerformanceCounters::create) Device::createPerformanceCountersFunc = PerformanceCounters::create;
@@ -81,10 +85,11 @@ Device::~Device() {
 bool Device::createDeviceImpl() {
     executionEnvironment->initGmm();
 
+    auto enginesStart = std::chrono::steady_clock::now();
     if (!createEngines()) {
         return false;
     }
-    executionEnvironment->memoryManager->setDefaultEngineIndex(defaultEngineIndex);
+    enginesInitializationTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - enginesStart).count());
 
     auto osInterface = executionEnvironment->osInterface.get();
 
@@ -127,7 +132,21 @@ bool Device::createEngines() {
     auto &hwInfo = getHardwareInfo();
     auto &gpgpuEngines = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getGpgpuEngineInstances();
 
+    // engines are handed out by reference and read without the device lock (getDefaultEngine),
+    // capacity has to cover lazily materialized ones as well so that registering them never reallocates
+    engines.reserve(gpgpuEngines.size());
+    commandStreamReceivers.reserve(gpgpuEngines.size());
+    lazyEngineInitialization = DebugManager.flags.LazyEngineInitialization.get();
+
+    if (DebugManager.flags.ParallelDeviceInitialization.get()) {
+        return createEnginesInParallel(gpgpuEngines);
+    }
+
     for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < gpgpuEngines.size(); deviceCsrIndex++) {
+        if (lazyEngineInitialization && !isDefaultEngine(deviceCsrIndex, gpgpuEngines[deviceCsrIndex])) {
+            lazyEngines.push_back({deviceCsrIndex, gpgpuEngines[deviceCsrIndex]});
+            continue;
+        }
         if (!createEngine(deviceCsrIndex, gpgpuEngines[deviceCsrIndex])) {
             return false;
         }
@@ -135,17 +154,71 @@ bool Device::createEngines() {
     return true;
 }
 
+bool Device::createEnginesInParallel(const std::vector<aub_stream::EngineType> &gpgpuEngines) {
+    struct PendingEngine {
+        uint32_t deviceCsrIndex;
+        aub_stream::EngineType engineType;
+        std::unique_ptr<CommandStreamReceiver> commandStreamReceiver;
+        OsContext *osContext;
+        bool initialized;
+    };
+    std::vector<PendingEngine> pendingEngines;
+    pendingEngines.reserve(gpgpuEngines.size());
+
+    // Context ids and memory manager registration order stay the same as in serial mode,
+    // only allocations backing the engines are created concurrently.
+    for (uint32_t deviceCsrIndex = 0; deviceCsrIndex < gpgpuEngines.size(); deviceCsrIndex++) {
+        if (lazyEngineInitialization && !isDefaultEngine(deviceCsrIndex, gpgpuEngines[deviceCsrIndex])) {
+            lazyEngines.push_back({deviceCsrIndex, gpgpuEngines[deviceCsrIndex]});
+            continue;
+        }
+        std::unique_ptr<CommandStreamReceiver> commandStreamReceiver;
+        auto osContext = setupEngine(deviceCsrIndex, gpgpuEngines[deviceCsrIndex], commandStreamReceiver);
+        if (!osContext) {
+            return false;
+        }
+        pendingEngines.push_back({deviceCsrIndex, gpgpuEngines[deviceCsrIndex], std::move(commandStreamReceiver), osContext, false});
+    }
+
+    std::vector<std::thread> initThreads;
+    for (size_t i = 1; i < pendingEngines.size(); i++) {
+        initThreads.emplace_back([this, &pendingEngines, i]() {
+            pendingEngines[i].initialized = initializeEngineAllocations(*pendingEngines[i].commandStreamReceiver);
+        });
+    }
+    if (!pendingEngines.empty()) {
+        pendingEngines[0].initialized = initializeEngineAllocations(*pendingEngines[0].commandStreamReceiver);
+    }
+    for (auto &initThread : initThreads) {
+        initThread.join();
+    }
+
+    for (auto &pendingEngine : pendingEngines) {
+        if (!pendingEngine.initialized) {
+            return false;
+        }
+    }
+    for (auto &pendingEngine : pendingEngines) {
+        registerEngine(pendingEngine.deviceCsrIndex, pendingEngine.engineType, std::move(pendingEngine.commandStreamReceiver), pendingEngine.osContext);
+    }
+    return true;
+}
+
 std::unique_ptr<CommandStreamReceiver> Device::createCommandStreamReceiver() const {
     return std::unique_ptr<CommandStreamReceiver>(createCommandStream(*executionEnvironment, getRootDeviceIndex()));
 }
 
-bool Device::createEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType) {
+bool Device::isDefaultEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType) const {
+    bool lowPriority = (deviceCsrIndex == HwHelper::lowPriorityGpgpuEngineIndex);
+    return engineType == getChosenEngineType(getHardwareInfo()) && !lowPriority;
+}
+
+OsContext *Device::setupEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType, std::unique_ptr<CommandStreamReceiver> &commandStreamReceiver) {
     auto &hwInfo = getHardwareInfo();
-    auto defaultEngineType = getChosenEngineType(hwInfo);
 
-    std::unique_ptr<CommandStreamReceiver> commandStreamReceiver = createCommandStreamReceiver();
+    commandStreamReceiver = createCommandStreamReceiver();
     if (!commandStreamReceiver) {
-        return false;
+        return nullptr;
     }
     if (HwHelper::get(hwInfo.platform.eRenderCoreFamily).isPageTableManagerSupported(hwInfo)) {
         commandStreamReceiver->createPageTableManager();
@@ -155,24 +228,61 @@ bool Device::createEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engine
     auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(commandStreamReceiver.get(), engineType,
                                                                                      getDeviceBitfield(), preemptionMode, lowPriority);
     commandStreamReceiver->setupContext(*osContext);
+    return osContext;
+}
 
-    if (!commandStreamReceiver->initializeTagAllocation()) {
+bool Device::initializeEngineAllocations(CommandStreamReceiver &commandStreamReceiver) {
+    if (!commandStreamReceiver.initializeTagAllocation()) {
         return false;
     }
-    if (engineType == defaultEngineType && !lowPriority) {
-        defaultEngineIndex = deviceCsrIndex;
-    }
-
-    if ((preemptionMode == PreemptionMode::MidThread || isSourceLevelDebuggerActive()) && !commandStreamReceiver->createPreemptionAllocation()) {
+    if ((preemptionMode == PreemptionMode::MidThread || isSourceLevelDebuggerActive()) && !commandStreamReceiver.createPreemptionAllocation()) {
         return false;
     }
+    return true;
+}
 
+void Device::registerEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType, std::unique_ptr<CommandStreamReceiver> commandStreamReceiver, OsContext *osContext) {
+    if (isDefaultEngine(deviceCsrIndex, engineType)) {
+        defaultEngineIndex = static_cast<uint32_t>(engines.size());
+    }
+    DEBUG_BREAK_IF(engines.size() == engines.capacity());
     engines.push_back({commandStreamReceiver.get(), osContext});
     commandStreamReceivers.push_back(std::move(commandStreamReceiver));
+}
 
+bool Device::createEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType) {
+    std::unique_ptr<CommandStreamReceiver> commandStreamReceiver;
+    auto osContext = setupEngine(deviceCsrIndex, engineType, commandStreamReceiver);
+    if (!osContext) {
+        return false;
+    }
+    if (!initializeEngineAllocations(*commandStreamReceiver)) {
+        return false;
+    }
+    registerEngine(deviceCsrIndex, engineType, std::move(commandStreamReceiver), osContext);
     return true;
 }
 
+EngineControl *Device::createLazyEngine(aub_stream::EngineType engineType, bool lowPriority) {
+    for (auto lazyEngine = lazyEngines.begin(); lazyEngine != lazyEngines.end(); ++lazyEngine) {
+        bool lazyEngineLowPriority = (lazyEngine->first == HwHelper::lowPriorityGpgpuEngineIndex);
+        if (lazyEngine->second != engineType || lazyEngineLowPriority != lowPriority) {
+            continue;
+        }
+        if (!createEngine(lazyEngine->first, lazyEngine->second)) {
+            return nullptr;
+        }
+        lazyEngines.erase(lazyEngine);
+
+        auto &engine = engines.back();
+        if (DebugManager.flags.EnableExperimentalCommandBuffer.get() > 0) {
+            engine.commandStreamReceiver->setExperimentalCmdBuffer(std::make_unique<ExperimentalCommandBuffer>(engine.commandStreamReceiver, getDeviceInfo().profilingTimerResolution));
+        }
+        return &engine;
+    }
+    return nullptr;
+}
+
 const HardwareInfo &Device::getHardwareInfo() const { return *executionEnvironment->getHardwareInfo(); }
 
 const DeviceInfo &Device::getDeviceInfo() const {
@@ -223,12 +333,16 @@ bool Device::isSourceLevelDebuggerActive() const {
 }
 
 EngineControl &Device::getEngine(aub_stream::EngineType engineType, bool lowPriority) {
+    TakeOwnershipWrapper<Device> deviceOwnership(*this, lazyEngineInitialization);
     for (auto &engine : engines) {
         if (engine.osContext->getEngineType() == engineType &&
             engine.osContext->isLowPriority() == lowPriority) {
             return engine;
         }
     }
+    if (auto lazyEngine = createLazyEngine(engineType, lowPriority)) {
+        return *lazyEngine;
+    }
     if (DebugManager.flags.OverrideInvalidEngineWithDefault.get()) {
         return engines[0];
     }
@@ -76,6 +76,7 @@ class Device : public BaseObject<_cl_device_id> {
     void allocateSyncBufferHandler();
     PerformanceCounters *getPerformanceCounters() { return performanceCounters.get(); }
     PreemptionMode getPreemptionMode() const { return preemptionMode; }
+    uint64_t peekEnginesInitializationTime() const { return enginesInitializationTime; }
     MOCKABLE_VIRTUAL bool isSourceLevelDebuggerActive() const;
     SourceLevelDebugger *getSourceLevelDebugger() { return executionEnvironment->sourceLevelDebugger.get(); }
     ExecutionEnvironment *getExecutionEnvironment() const { return executionEnvironment; }
@@ -116,6 +117,12 @@ class Device : public BaseObject<_cl_device_id> {
     virtual bool createDeviceImpl();
     virtual bool createEngines();
     bool createEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType);
+    bool createEnginesInParallel(const std::vector<aub_stream::EngineType> &gpgpuEngines);
+    EngineControl *createLazyEngine(aub_stream::EngineType engineType, bool lowPriority);
+    bool isDefaultEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType) const;
+    OsContext *setupEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType, std::unique_ptr<CommandStreamReceiver> &commandStreamReceiver);
+    bool initializeEngineAllocations(CommandStreamReceiver &commandStreamReceiver);
+    void registerEngine(uint32_t deviceCsrIndex, aub_stream::EngineType engineType, std::unique_ptr<CommandStreamReceiver> commandStreamReceiver, OsContext *osContext);
     MOCKABLE_VIRTUAL std::unique_ptr<CommandStreamReceiver> createCommandStreamReceiver() const;
 
     std::vector<unsigned int> simultaneousInterops;
@@ -132,9 +139,13 @@ class Device : public BaseObject<_cl_device_id> {
     std::unique_ptr<PerformanceCounters> performanceCounters;
     std::vector<std::unique_ptr<CommandStreamReceiver>> commandStreamReceivers;
     std::vector<EngineControl> engines;
+    // engines not created yet in lazy mode, as device csr index and engine type
+    std::vector<std::pair<uint32_t, aub_stream::EngineType>> lazyEngines;
+    bool lazyEngineInitialization = false;
     PreemptionMode preemptionMode;
     ExecutionEnvironment *executionEnvironment = nullptr;
     uint32_t defaultEngineIndex = 0;
+    uint64_t enginesInitializationTime = 0; // in microseconds
 };
 
 template <cl_device_info Param>
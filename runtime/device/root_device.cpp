@@ -9,7 +9,9 @@
 
 #include "core/debug_settings/debug_settings_manager.h"
 #include "runtime/device/sub_device.h"
+#include "runtime/execution_environment/execution_environment.h"
 #include "runtime/helpers/device_helpers.h"
+#include "runtime/memory_manager/memory_manager.h"
 
 namespace NEO {
 RootDevice::RootDevice(ExecutionEnvironment *executionEnvironment, uint32_t rootDeviceIndex) : Device(executionEnvironment), rootDeviceIndex(rootDeviceIndex) {}
@@ -61,6 +63,10 @@ bool RootDevice::createDeviceImpl() {
     if (!status) {
         return status;
     }
+    // root devices may be created concurrently, internal memory manager submissions always use the first one
+    if (getRootDeviceIndex() == 0) {
+        executionEnvironment->memoryManager->setDefaultEngineContext(getDefaultEngine().osContext);
+    }
     return true;
 }
 
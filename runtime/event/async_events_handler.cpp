@@ -7,18 +7,29 @@
 
 #include "runtime/event/async_events_handler.h"
 
+#include "core/debug_settings/debug_settings_manager.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/event/event.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace NEO {
+namespace {
+bool laterTaskCount(const Event *left, const Event *right) {
+    return left->peekTaskCount() > right->peekTaskCount();
+}
+} // namespace
+
 AsyncEventsHandler::AsyncEventsHandler() {
     allowAsyncProcess = false;
     registerList.reserve(64);
     list.reserve(64);
     pendingList.reserve(64);
+    completedList.reserve(64);
 }
 
 AsyncEventsHandler::~AsyncEventsHandler() {
@@ -35,25 +46,104 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+void AsyncEventsHandler::trackEvent(Event *event) {
+    bool externallySynchronized = event->isExternallySynchronized();
+    if (!event->peekHasCallbacks() && !(externallySynchronized && (event->peekExecutionStatus() > CL_COMPLETE))) {
+        event->decRefInternal();
+        return;
+    }
+
+    // submitted events can complete only when CSR tag reaches their task count, no need to check them earlier
+    auto cmdQueue = event->getCommandQueue();
+    if (cmdQueue != nullptr && !externallySynchronized && event->peekExecutionStatus() == CL_SUBMITTED && event->peekTaskCount() != Event::eventNotReady) {
+        auto &heap = completionHeaps[&cmdQueue->getGpgpuCommandStreamReceiver()];
+        heap.push_back(event);
+        std::push_heap(heap.begin(), heap.end(), laterTaskCount);
+        return;
+    }
+    pendingList.push_back(event);
+}
+
+void AsyncEventsHandler::collectCompletedEvents() {
+    for (auto it = completionHeaps.begin(); it != completionHeaps.end();) {
+        auto &heap = it->second;
+        auto tag = *it->first->getTagAddress();
+        while (!heap.empty() && heap.front()->peekTaskCount() <= tag) {
+            std::pop_heap(heap.begin(), heap.end(), laterTaskCount);
+            completedList.push_back(heap.back());
+            heap.pop_back();
+        }
+        if (heap.empty()) {
+            it = completionHeaps.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void AsyncEventsHandler::dispatchCompletedEvents() {
+    if (completedList.empty()) {
+        return;
+    }
+
+    if (callbackWorkers.empty() || completedList.size() == 1) {
+        for (auto event : completedList) {
+            event->updateExecutionStatus();
+        }
+    } else {
+        std::unique_lock<std::mutex> lock(workersMtx);
+        nextCompletedEvent = 0;
+        activeWorkers = callbackWorkers.size();
+        dispatchGeneration++;
+        workersCond.notify_all();
+        lock.unlock();
+
+        runCompletedEvents();
+
+        lock.lock();
+        workersDoneCond.wait(lock, [this] { return activeWorkers == 0; });
+    }
+
+    for (auto event : completedList) {
+        trackEvent(event);
+    }
+    completedList.clear();
+}
+
+void AsyncEventsHandler::runCompletedEvents() {
+    for (size_t i = nextCompletedEvent++; i < completedList.size(); i = nextCompletedEvent++) {
+        completedList[i]->updateExecutionStatus();
+    }
+}
+
 Event *AsyncEventsHandler::processList() {
     uint32_t lowestTaskCount = Event::eventNotReady;
     Event *sleepCandidate = nullptr;
     pendingList.clear();
 
+    collectCompletedEvents();
+    dispatchCompletedEvents();
+
     for (auto event : list) {
         event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
-            if (event->peekTaskCount() < lowestTaskCount) {
-                sleepCandidate = event;
-                lowestTaskCount = event->peekTaskCount();
-            }
-        } else {
-            event->decRefInternal();
-        }
+        trackEvent(event);
     }
 
     list.swap(pendingList);
+
+    for (auto event : list) {
+        if (event->peekTaskCount() < lowestTaskCount) {
+            sleepCandidate = event;
+            lowestTaskCount = event->peekTaskCount();
+        }
+    }
+    for (auto &heap : completionHeaps) {
+        auto event = heap.second.front();
+        if (event->peekTaskCount() < lowestTaskCount) {
+            sleepCandidate = event;
+            lowestTaskCount = event->peekTaskCount();
+        }
+    }
     return sleepCandidate;
 }
 
@@ -70,7 +160,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (!self->hasPendingEvents()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -93,26 +183,84 @@ void AsyncEventsHandler::closeThread() {
         thread.get()->join();
         thread.reset(nullptr);
     }
+    closeCallbackWorkers();
 }
 
 void AsyncEventsHandler::openThread() {
     if (!thread.get()) {
         DEBUG_BREAK_IF(allowAsyncProcess);
         allowAsyncProcess = true;
+        if (DebugManager.flags.AsyncEventsHandlerCallbackThreads.get() > 0) {
+            openCallbackWorkers(static_cast<uint32_t>(DebugManager.flags.AsyncEventsHandlerCallbackThreads.get()));
+        }
         thread = Thread::create(asyncProcess, reinterpret_cast<void *>(this));
     }
 }
 
+void AsyncEventsHandler::openCallbackWorkers(uint32_t numWorkers) {
+    std::unique_lock<std::mutex> lock(workersMtx);
+    allowCallbackWorkers = true;
+    dispatchGeneration = 0;
+    lock.unlock();
+    for (uint32_t i = 0; i < numWorkers; i++) {
+        callbackWorkers.push_back(Thread::create(callbackWorker, reinterpret_cast<void *>(this)));
+    }
+}
+
+void AsyncEventsHandler::closeCallbackWorkers() {
+    std::unique_lock<std::mutex> lock(workersMtx);
+    allowCallbackWorkers = false;
+    workersCond.notify_all();
+    lock.unlock();
+    for (auto &worker : callbackWorkers) {
+        worker->join();
+    }
+    callbackWorkers.clear();
+}
+
+void *AsyncEventsHandler::callbackWorker(void *arg) {
+    auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
+    std::unique_lock<std::mutex> lock(self->workersMtx);
+    uint64_t seenGeneration = 0;
+
+    while (true) {
+        self->workersCond.wait(lock, [&] { return !self->allowCallbackWorkers || self->dispatchGeneration != seenGeneration; });
+        if (!self->allowCallbackWorkers) {
+            break;
+        }
+        seenGeneration = self->dispatchGeneration;
+        lock.unlock();
+
+        self->runCompletedEvents();
+
+        lock.lock();
+        if (--self->activeWorkers == 0) {
+            self->workersDoneCond.notify_one();
+        }
+    }
+    return nullptr;
+}
+
 void AsyncEventsHandler::transferRegisterList() {
     std::move(registerList.begin(), registerList.end(), std::back_inserter(list));
     registerList.clear();
 }
 
+bool AsyncEventsHandler::hasPendingEvents() const {
+    return !list.empty() || !completionHeaps.empty();
+}
+
 void AsyncEventsHandler::releaseEvents() {
     for (auto event : list) {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &heap : completionHeaps) {
+        for (auto event : heap.second) {
+            event->decRefInternal();
+        }
+    }
+    completionHeaps.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace NEO
@@ -8,11 +8,14 @@
 #pragma once
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,18 +27,40 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    // Submitted events waiting for GPU completion, kept as a min-heap ordered by task count
+    using CompletionHeap = std::vector<Event *>;
+
     Event *processList();
     static void *asyncProcess(void *arg);
+    static void *callbackWorker(void *arg);
     void releaseEvents();
+    void trackEvent(Event *event);
+    void collectCompletedEvents();
+    void dispatchCompletedEvents();
+    void runCompletedEvents();
+    bool hasPendingEvents() const;
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
+    void openCallbackWorkers(uint32_t numWorkers);
+    void closeCallbackWorkers();
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<Event *> completedList;
+    std::unordered_map<CommandStreamReceiver *, CompletionHeap> completionHeaps;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
     std::atomic<bool> allowAsyncProcess;
+
+    std::vector<std::unique_ptr<Thread>> callbackWorkers;
+    std::mutex workersMtx;
+    std::condition_variable workersCond;
+    std::condition_variable workersDoneCond;
+    std::atomic<size_t> nextCompletedEvent{0};
+    size_t activeWorkers = 0;
+    uint64_t dispatchGeneration = 0;
+    bool allowCallbackWorkers = false;
 };
 } // namespace NEO
@@ -26,6 +26,8 @@
 #include "runtime/platform/platform.h"
 #include "runtime/utilities/tag_allocator.h"
 
+#include <algorithm>
+
 #define OCLRT_NUM_TIMESTAMP_BITS (32)
 
 namespace NEO {
@@ -52,7 +54,6 @@ Event::Event(
     }
     parentCount = 0;
     executionStatus = CL_QUEUED;
-    flushStamp.reset(new FlushStampTracker(true));
 
     DBG_LOG(EventsDebugEnable, "Event()", this);
 
@@ -75,6 +76,9 @@ Event::Event(
         this->ctx->incRefInternal();
     }
 
+    auto objectPool = this->ctx ? this->ctx->getObjectPool() : nullptr;
+    flushStamp.reset(new (objectPool) FlushStampTracker(true, objectPool));
+
     queueTimeStamp = {0, 0};
     submitTimeStamp = {0, 0};
     startTimeStamp = 0;
@@ -518,12 +522,30 @@ cl_int Event::waitForEvents(cl_uint numEvents,
         return CL_SUCCESS;
     }
 
+    // events from the same command queue are flushed and waited on together,
+    // only for the highest task count (and flush stamp) found in the list
+    struct QueueWait {
+        CommandQueue *cmdQueue;
+        uint32_t taskCount;
+        FlushStamp flushStamp;
+    };
+    StackVec<QueueWait, 8> queueWaits;
+    auto findQueueWait = [&queueWaits](CommandQueue *cmdQueue) -> QueueWait * {
+        for (auto &queueWait : queueWaits) {
+            if (queueWait.cmdQueue == cmdQueue) {
+                return &queueWait;
+            }
+        }
+        return nullptr;
+    };
+
     //flush all command queues
     for (const cl_event *it = eventList, *end = eventList + numEvents; it != end; ++it) {
         Event *event = castToObjectOrAbort<Event>(*it);
         if (event->cmdQueue) {
-            if (event->taskLevel != Event::eventNotReady) {
+            if (event->taskLevel != Event::eventNotReady && findQueueWait(event->cmdQueue) == nullptr) {
                 event->cmdQueue->flush();
+                queueWaits.push_back({event->cmdQueue, 0, 0});
             }
         }
     }
@@ -532,23 +554,52 @@ cl_int Event::waitForEvents(cl_uint numEvents,
     WorkerListT workerList1(eventList, eventList + numEvents);
     WorkerListT workerList2;
     workerList2.reserve(numEvents);
+    WorkerListT batchedEvents;
 
     // pointers to workerLists - for fast swap operations
     WorkerListT *currentlyPendingEvents = &workerList1;
     WorkerListT *pendingEventsLeft = &workerList2;
 
     while (currentlyPendingEvents->size() > 0) {
+        for (auto &queueWait : queueWaits) {
+            queueWait.taskCount = 0;
+            queueWait.flushStamp = 0;
+        }
+        batchedEvents.clear();
+
         for (auto &e : *currentlyPendingEvents) {
             Event *event = castToObjectOrAbort<Event>(e);
             if (event->peekExecutionStatus() < CL_COMPLETE) {
                 return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
             }
 
+            auto queueWait = event->isBatchedWaitPossible() ? findQueueWait(event->cmdQueue) : nullptr;
+            if (queueWait) {
+                queueWait->taskCount = std::max(queueWait->taskCount, event->peekTaskCount());
+                queueWait->flushStamp = std::max(queueWait->flushStamp, event->flushStamp->peekStamp());
+                batchedEvents.push_back(event);
+                continue;
+            }
+
             if (event->wait(false, false) == false) {
                 pendingEventsLeft->push_back(event);
             }
         }
 
+        for (auto &queueWait : queueWaits) {
+            if (queueWait.taskCount != 0) {
+                queueWait.cmdQueue->waitUntilComplete(queueWait.taskCount, queueWait.flushStamp, false);
+            }
+        }
+
+        for (auto &e : batchedEvents) {
+            Event *event = castToObjectOrAbort<Event>(e);
+            event->updateExecutionStatus();
+            if (event->peekExecutionStatus() > CL_COMPLETE) {
+                pendingEventsLeft->push_back(event);
+            }
+        }
+
         std::swap(currentlyPendingEvents, pendingEventsLeft);
         pendingEventsLeft->clear();
     }
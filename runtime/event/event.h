@@ -16,6 +16,7 @@
 #include "runtime/helpers/task_information.h"
 #include "runtime/os_interface/os_time.h"
 #include "runtime/os_interface/performance_counters.h"
+#include "runtime/utilities/object_pool.h"
 
 #include <atomic>
 #include <cstdint>
@@ -34,7 +35,7 @@ struct OpenCLObjectMapper<_cl_event> {
     typedef class Event DerivedType;
 };
 
-class Event : public BaseObject<_cl_event>, public IDNode<Event> {
+class Event : public BaseObject<_cl_event>, public IDNode<Event>, public PoolableObject {
   public:
     enum class ECallbackTarget : uint32_t {
         Queued = 0,
@@ -295,6 +296,11 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
         return false;
     }
 
+    // true when completion can be awaited together with other events of the same queue
+    virtual bool isBatchedWaitPossible() const {
+        return (cmdQueue != nullptr) && (taskCount != Event::eventNotReady) && !isExternallySynchronized();
+    }
+
     static bool checkUserEventDependencies(cl_uint numEventsInWaitList, const cl_event *eventWaitList);
 
   protected:
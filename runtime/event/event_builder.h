@@ -16,6 +16,7 @@
 namespace NEO {
 
 class Event;
+class ObjectPool;
 
 class EventBuilder {
   public:
@@ -24,6 +25,11 @@ class EventBuilder {
         event = new EventType(std::forward<ArgsT>(args)...);
     }
 
+    template <typename EventType, typename... ArgsT>
+    void createFromPool(ObjectPool *objectPool, ArgsT &&... args) {
+        event = new (objectPool) EventType(std::forward<ArgsT>(args)...);
+    }
+
     EventBuilder() = default;
     EventBuilder(const EventBuilder &) = delete;
     EventBuilder &operator=(const EventBuilder &) = delete;
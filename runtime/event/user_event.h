@@ -37,6 +37,8 @@ class VirtualEvent : public Event {
 
     bool setStatus(cl_int status) override;
 
+    bool isBatchedWaitPossible() const override { return false; }
+
     void updateExecutionStatus() override;
 
     uint32_t getTaskLevel() override;
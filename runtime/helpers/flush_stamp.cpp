@@ -9,9 +9,9 @@
 
 using namespace NEO;
 
-FlushStampTracker::FlushStampTracker(bool allocateStamp) {
+FlushStampTracker::FlushStampTracker(bool allocateStamp, ObjectPool *objectPool) {
     if (allocateStamp) {
-        flushStampSharedHandle = new FlushStampTrackingObj();
+        flushStampSharedHandle = new (objectPool) FlushStampTrackingObj();
         flushStampSharedHandle->incRefInternal();
     }
 }
@@ -10,17 +10,18 @@
 #include "core/helpers/completion_stamp.h"
 #include "core/utilities/reference_tracked_object.h"
 #include "core/utilities/stackvec.h"
+#include "runtime/utilities/object_pool.h"
 
 namespace NEO {
-struct FlushStampTrackingObj : public ReferenceTrackedObject<FlushStampTrackingObj> {
+struct FlushStampTrackingObj : public ReferenceTrackedObject<FlushStampTrackingObj>, public PoolableObject {
     FlushStamp flushStamp = 0;
     std::atomic<bool> initialized{false};
 };
 
-class FlushStampTracker {
+class FlushStampTracker : public PoolableObject {
   public:
     FlushStampTracker() = delete;
-    FlushStampTracker(bool allocateStamp);
+    FlushStampTracker(bool allocateStamp, ObjectPool *objectPool = nullptr);
     ~FlushStampTracker();
 
     FlushStamp peekStamp() const;
@@ -180,8 +180,23 @@ size_t HardwareCommandsHelper<GfxFamily>::sendInterfaceDescriptorData(
     INTERFACE_DESCRIPTOR_DATA *inlineInterfaceDescriptor) {
     using SAMPLER_STATE = typename GfxFamily::SAMPLER_STATE;
 
+    static_assert(sizeof(INTERFACE_DESCRIPTOR_DATA) <= KernelDispatchTemplate::maxInterfaceDescriptorSize, "Interface descriptor does not fit in dispatch template");
+
     // Allocate some memory for the interface descriptor
     auto pInterfaceDescriptor = getInterfaceDescriptor(indirectHeap, offsetInterfaceDescriptor, inlineInterfaceDescriptor);
+
+    // Everything except heap offsets is the same as on previous enqueue of this kernel with matching sizes
+    auto useDispatchTemplate = DebugManager.flags.EnableKernelDispatchTemplates.get();
+    KernelDispatchTemplate::InterfaceDescriptorKey interfaceDescriptorKey = {kernelStartOffset, sizeCrossThreadData, sizePerThreadData,
+                                                                             threadsPerThreadGroup, numSamplers, bindingTablePrefetchSize,
+                                                                             kernel.slmTotalSize, preemptionMode};
+    if (useDispatchTemplate &&
+        kernel.getDispatchTemplate().restoreInterfaceDescriptor(interfaceDescriptorKey, pInterfaceDescriptor, sizeof(INTERFACE_DESCRIPTOR_DATA))) {
+        pInterfaceDescriptor->setBindingTablePointer(static_cast<uint32_t>(bindingTablePointer));
+        pInterfaceDescriptor->setSamplerStatePointer(static_cast<uint32_t>(offsetSamplerState));
+        return (size_t)offsetInterfaceDescriptor;
+    }
+
     *pInterfaceDescriptor = GfxFamily::cmdInitInterfaceDescriptorData;
 
     // Program the kernel start pointer
@@ -214,6 +229,10 @@ size_t HardwareCommandsHelper<GfxFamily>::sendInterfaceDescriptorData(
 
     pInterfaceDescriptor->setBindingTableEntryCount(bindingTablePrefetchSize);
 
+    if (useDispatchTemplate) {
+        kernel.getDispatchTemplate().recordInterfaceDescriptor(interfaceDescriptorKey, pInterfaceDescriptor, sizeof(INTERFACE_DESCRIPTOR_DATA));
+    }
+
     return (size_t)offsetInterfaceDescriptor;
 }
 
@@ -302,7 +321,16 @@ size_t HardwareCommandsHelper<GfxFamily>::sendIndirectState(
 
     const auto &patchInfo = kernelInfo.patchInfo;
 
-    auto dstBindingTablePointer = pushBindingTableAndSurfaceStates(ssh, kernel);
+    // Surface states pushed by previous dispatch of this kernel are still valid if the heap buffer wasn't replaced
+    size_t dstBindingTablePointer = 0;
+    auto &dispatchTemplate = kernel.getDispatchTemplate();
+    auto sshReuseAllowed = DebugManager.flags.EnableKernelDispatchTemplates.get() && kernel.getNumberOfBindingTableStates() > 0;
+    if (!sshReuseAllowed || !dispatchTemplate.reuseSurfaceStateHeap(ssh.getBufferGeneration(), dstBindingTablePointer)) {
+        dstBindingTablePointer = pushBindingTableAndSurfaceStates(ssh, kernel);
+        if (sshReuseAllowed) {
+            dispatchTemplate.recordSurfaceStateHeap(ssh.getBufferGeneration(), dstBindingTablePointer);
+        }
+    }
 
     // Copy our sampler state if it exists
     size_t samplerStateOffset = 0;
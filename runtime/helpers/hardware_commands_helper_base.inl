@@ -123,14 +123,22 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
 
     uint32_t grfSize = sizeof(typename GfxFamily::GRF);
 
-    sendPerThreadData(
-        ioh,
-        simd,
-        grfSize,
-        numChannels,
-        localWorkSize,
-        kernel.getKernelInfo().workgroupDimensionsOrder,
-        kernel.usesOnlyImages());
+    if (DebugManager.flags.EnableKernelDispatchTemplates.get()) {
+        KernelDispatchTemplate::PerThreadDataKey perThreadDataKey = {simd, grfSize, numChannels,
+                                                                     {{localWorkSize[0], localWorkSize[1], localWorkSize[2]}},
+                                                                     kernel.getKernelInfo().workgroupDimensionsOrder,
+                                                                     kernel.usesOnlyImages()};
+        kernel.getDispatchTemplate().sendPerThreadData(ioh, perThreadDataKey);
+    } else {
+        sendPerThreadData(
+            ioh,
+            simd,
+            grfSize,
+            numChannels,
+            localWorkSize,
+            kernel.getKernelInfo().workgroupDimensionsOrder,
+            kernel.usesOnlyImages());
+    }
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
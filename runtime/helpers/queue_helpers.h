@@ -21,6 +21,15 @@ inline void releaseVirtualEvent(CommandQueue &commandQueue) {
 inline void releaseVirtualEvent(DeviceQueue &commandQueue) {
 }
 
+inline void restoreDeferredAuxTranslations(CommandQueue &commandQueue) {
+    if (commandQueue.getRefApiCount() == 1) {
+        commandQueue.restoreDeferredAuxTranslations();
+    }
+}
+
+inline void restoreDeferredAuxTranslations(DeviceQueue &commandQueue) {
+}
+
 bool isCommandWithoutKernel(uint32_t commandType);
 
 template <typename QueueType>
@@ -40,6 +49,7 @@ void releaseQueue(cl_command_queue commandQueue, cl_int &retVal) {
     using BaseType = typename QueueType::BaseType;
     auto queue = castToObject<QueueType>(static_cast<BaseType *>(commandQueue));
     if (queue) {
+        restoreDeferredAuxTranslations(*queue);
         releaseVirtualEvent(*queue);
         queue->release();
         retVal = CL_SUCCESS;
@@ -14,6 +14,7 @@
 #include "runtime/helpers/blit_commands_helper.h"
 #include "runtime/helpers/properties_helper.h"
 #include "runtime/helpers/timestamp_packet.h"
+#include "runtime/utilities/object_pool.h"
 
 #include <memory>
 #include <vector>
@@ -80,7 +81,7 @@ struct KernelOperation {
     size_t surfaceStateHeapSizeEM = 0;
 };
 
-class Command : public IFNode<Command> {
+class Command : public IFNode<Command>, public PoolableObject {
   public:
     // returns command's taskCount obtained from completion stamp
     //   as acquired from command stream receiver
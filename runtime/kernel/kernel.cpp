@@ -773,6 +773,8 @@ const void *Kernel::getSurfaceStateHeap() const {
 }
 
 void *Kernel::getSurfaceStateHeap() {
+    // Caller may modify surface states, so they can't be reused from heaps they were pushed to
+    dispatchTemplate.markSurfaceStateHeapDirty();
     return kernelInfo.usesSsh ? pSshLocal.get() : nullptr;
 }
 
@@ -795,6 +797,7 @@ size_t Kernel::getNumberOfBindingTableStates() const {
 }
 
 void Kernel::resizeSurfaceStateHeap(void *pNewSsh, size_t newSshSize, size_t newBindingTableCount, size_t newBindingTableOffset) {
+    dispatchTemplate.markSurfaceStateHeapDirty();
     pSshLocal.reset(static_cast<char *>(pNewSsh));
     sshLocalSize = static_cast<uint32_t>(newSshSize);
     numberOfBindingTableStates = newBindingTableCount;
@@ -18,6 +18,7 @@
 #include "runtime/device_queue/device_queue.h"
 #include "runtime/helpers/base_object.h"
 #include "runtime/helpers/properties_helper.h"
+#include "runtime/kernel/kernel_dispatch_template.h"
 #include "runtime/program/kernel_info.h"
 #include "runtime/program/program.h"
 
@@ -401,6 +402,10 @@ class Kernel : public BaseObject<_cl_kernel> {
 
     uint32_t getMaxWorkGroupCount(const cl_uint workDim, const size_t *localWorkSize) const;
 
+    KernelDispatchTemplate &getDispatchTemplate() const {
+        return dispatchTemplate;
+    }
+
   protected:
     struct ObjectCounts {
         uint32_t imageCount;
@@ -532,5 +537,6 @@ class Kernel : public BaseObject<_cl_kernel> {
     std::vector<GraphicsAllocation *> kernelArgRequiresCacheFlush;
     UnifiedMemoryControls unifiedMemoryControls;
     bool isUnifiedMemorySyncRequired = true;
+    mutable KernelDispatchTemplate dispatchTemplate;
 };
 } // namespace NEO
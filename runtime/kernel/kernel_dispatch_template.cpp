@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/kernel/kernel_dispatch_template.h"
+
+#include "core/command_stream/linear_stream.h"
+#include "core/helpers/debug_helpers.h"
+#include "core/helpers/string.h"
+#include "runtime/helpers/per_thread_data.h"
+
+namespace NEO {
+
+size_t KernelDispatchTemplate::sendPerThreadData(LinearStream &indirectHeap, const PerThreadDataKey &key) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto offsetPerThreadData = indirectHeap.getUsed();
+    if (perThreadDataValid && perThreadDataKey == key) {
+        if (!perThreadData.empty()) {
+            auto pDest = indirectHeap.getSpace(perThreadData.size());
+            memcpy_s(pDest, perThreadData.size(), perThreadData.data(), perThreadData.size());
+        }
+        perThreadDataReuseCount++;
+        return offsetPerThreadData;
+    }
+
+    const size_t localWorkSize[3] = {key.localWorkSize[0], key.localWorkSize[1], key.localWorkSize[2]};
+    PerThreadDataHelper::sendPerThreadData(indirectHeap, key.simd, key.grfSize, key.numChannels,
+                                           localWorkSize, key.workgroupWalkOrder, key.hasKernelOnlyImages);
+
+    auto sizePerThreadDataTotal = indirectHeap.getUsed() - offsetPerThreadData;
+    auto pSrc = static_cast<const uint8_t *>(indirectHeap.getCpuBase()) + offsetPerThreadData;
+    perThreadData.assign(pSrc, pSrc + sizePerThreadDataTotal);
+    perThreadDataKey = key;
+    perThreadDataValid = true;
+    return offsetPerThreadData;
+}
+
+bool KernelDispatchTemplate::restoreInterfaceDescriptor(const InterfaceDescriptorKey &key, void *interfaceDescriptor, size_t size) {
+    DEBUG_BREAK_IF(size > maxInterfaceDescriptorSize);
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (!interfaceDescriptorValid || !(interfaceDescriptorKey == key)) {
+        return false;
+    }
+    memcpy_s(interfaceDescriptor, size, this->interfaceDescriptor.data(), size);
+    interfaceDescriptorReuseCount++;
+    return true;
+}
+
+void KernelDispatchTemplate::recordInterfaceDescriptor(const InterfaceDescriptorKey &key, const void *interfaceDescriptor, size_t size) {
+    DEBUG_BREAK_IF(size > maxInterfaceDescriptorSize);
+    std::lock_guard<std::mutex> lock(mtx);
+
+    memcpy_s(this->interfaceDescriptor.data(), this->interfaceDescriptor.size(), interfaceDescriptor, size);
+    interfaceDescriptorKey = key;
+    interfaceDescriptorValid = true;
+}
+
+bool KernelDispatchTemplate::reuseSurfaceStateHeap(uint64_t heapGeneration, size_t &bindingTablePointer) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    if (!surfaceStateHeapValid || surfaceStateHeapGeneration != heapGeneration) {
+        return false;
+    }
+    bindingTablePointer = surfaceStateHeapBindingTablePointer;
+    surfaceStateHeapReuseCount++;
+    return true;
+}
+
+void KernelDispatchTemplate::recordSurfaceStateHeap(uint64_t heapGeneration, size_t bindingTablePointer) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    surfaceStateHeapGeneration = heapGeneration;
+    surfaceStateHeapBindingTablePointer = bindingTablePointer;
+    surfaceStateHeapValid = true;
+}
+
+void KernelDispatchTemplate::markSurfaceStateHeapDirty() {
+    std::lock_guard<std::mutex> lock(mtx);
+    surfaceStateHeapValid = false;
+}
+} // namespace NEO
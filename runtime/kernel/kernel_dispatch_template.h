@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/command_stream/preemption_mode.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class LinearStream;
+
+// Parts of a walker dispatch that depend only on the kernel and the enqueue geometry.
+// They are recorded on the first enqueue and copied on subsequent ones instead of being rebuilt.
+// Surface states pushed to a heap are reused in place while the kernel's ssh stays clean
+// and the heap keeps the same buffer.
+class KernelDispatchTemplate {
+  public:
+    static constexpr size_t maxInterfaceDescriptorSize = 64;
+
+    struct PerThreadDataKey {
+        uint32_t simd;
+        uint32_t grfSize;
+        uint32_t numChannels;
+        std::array<size_t, 3> localWorkSize;
+        std::array<uint8_t, 3> workgroupWalkOrder;
+        bool hasKernelOnlyImages;
+
+        bool operator==(const PerThreadDataKey &other) const {
+            return simd == other.simd && grfSize == other.grfSize && numChannels == other.numChannels &&
+                   localWorkSize == other.localWorkSize && workgroupWalkOrder == other.workgroupWalkOrder &&
+                   hasKernelOnlyImages == other.hasKernelOnlyImages;
+        }
+    };
+
+    struct InterfaceDescriptorKey {
+        uint64_t kernelStartOffset;
+        size_t sizeCrossThreadData;
+        size_t sizePerThreadData;
+        uint32_t threadsPerThreadGroup;
+        uint32_t numSamplers;
+        uint32_t bindingTablePrefetchSize;
+        uint32_t slmTotalSize;
+        PreemptionMode preemptionMode;
+
+        bool operator==(const InterfaceDescriptorKey &other) const {
+            return kernelStartOffset == other.kernelStartOffset && sizeCrossThreadData == other.sizeCrossThreadData &&
+                   sizePerThreadData == other.sizePerThreadData && threadsPerThreadGroup == other.threadsPerThreadGroup &&
+                   numSamplers == other.numSamplers && bindingTablePrefetchSize == other.bindingTablePrefetchSize &&
+                   slmTotalSize == other.slmTotalSize && preemptionMode == other.preemptionMode;
+        }
+    };
+
+    size_t sendPerThreadData(LinearStream &indirectHeap, const PerThreadDataKey &key);
+
+    bool restoreInterfaceDescriptor(const InterfaceDescriptorKey &key, void *interfaceDescriptor, size_t size);
+    void recordInterfaceDescriptor(const InterfaceDescriptorKey &key, const void *interfaceDescriptor, size_t size);
+
+    bool reuseSurfaceStateHeap(uint64_t heapGeneration, size_t &bindingTablePointer);
+    void recordSurfaceStateHeap(uint64_t heapGeneration, size_t bindingTablePointer);
+    void markSurfaceStateHeapDirty();
+
+    uint32_t getPerThreadDataReuseCount() const { return perThreadDataReuseCount; }
+    uint32_t getInterfaceDescriptorReuseCount() const { return interfaceDescriptorReuseCount; }
+    uint32_t getSurfaceStateHeapReuseCount() const { return surfaceStateHeapReuseCount; }
+
+  protected:
+    std::mutex mtx;
+
+    bool perThreadDataValid = false;
+    PerThreadDataKey perThreadDataKey = {};
+    std::vector<uint8_t> perThreadData;
+    uint32_t perThreadDataReuseCount = 0;
+
+    bool interfaceDescriptorValid = false;
+    InterfaceDescriptorKey interfaceDescriptorKey = {};
+    std::array<uint8_t, maxInterfaceDescriptorSize> interfaceDescriptor = {};
+    uint32_t interfaceDescriptorReuseCount = 0;
+
+    bool surfaceStateHeapValid = false;
+    uint64_t surfaceStateHeapGeneration = 0;
+    size_t surfaceStateHeapBindingTablePointer = 0;
+    uint32_t surfaceStateHeapReuseCount = 0;
+};
+} // namespace NEO
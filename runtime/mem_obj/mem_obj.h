@@ -26,6 +26,7 @@ class GraphicsAllocation;
 struct KernelInfo;
 class MemoryManager;
 class Context;
+class CommandQueue;
 
 template <>
 struct OpenCLObjectMapper<_cl_mem> {
@@ -126,6 +127,13 @@ class MemObj : public BaseObject<_cl_mem> {
     const cl_mem_flags &getMemoryPropertiesFlags() const { return flags; }
     const cl_mem_flags &getMemoryPropertiesFlagsIntel() const { return flagsIntel; }
 
+    // Queue which left this object in non-aux state and owes the translation back to aux.
+    // Ownership can be taken over by another queue, so it is exchanged atomically.
+    CommandQueue *getDeferredAuxTranslationQueue() const { return deferredAuxTranslationQueue.load(); }
+    void setDeferredAuxTranslationQueue(CommandQueue *commandQueue) { deferredAuxTranslationQueue.store(commandQueue); }
+    bool takeDeferredAuxTranslation() { return deferredAuxTranslationQueue.exchange(nullptr) != nullptr; }
+    bool releaseDeferredAuxTranslation(CommandQueue *commandQueue) { return deferredAuxTranslationQueue.compare_exchange_strong(commandQueue, nullptr); }
+
   protected:
     void getOsSpecificMemObjectInfo(const cl_mem_info &paramName, size_t *srcParamSize, void **srcParam);
 
@@ -152,6 +160,7 @@ class MemObj : public BaseObject<_cl_mem> {
     GraphicsAllocation *mcsAllocation = nullptr;
     GraphicsAllocation *mapAllocation = nullptr;
     std::shared_ptr<SharingHandler> sharingHandler;
+    std::atomic<CommandQueue *> deferredAuxTranslationQueue{nullptr};
 
     class DestructorCallback {
       public:
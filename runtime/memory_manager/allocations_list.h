@@ -8,7 +8,10 @@
 #pragma once
 #include "core/memory_manager/graphics_allocation.h"
 
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -17,7 +20,35 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
   public:
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, CommandStreamReceiver &commandStreamReceiver, GraphicsAllocation::AllocationType allocationType);
 
+    // list modifiers below hide the IDList ones, so size classes stay in sync with the list
+    void pushFrontOne(GraphicsAllocation &node);
+    void pushTailOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &nodes);
+    void deleteAll();
+
+    size_t peekTotalSize() const { return totalSize.load(); }
+
   private:
+    static constexpr uint32_t sizeClassCount = 65u;
+    static uint32_t getSizeClass(size_t size);
+    void addToSizeClass(GraphicsAllocation &node);
+    void removeFromSizeClass(GraphicsAllocation &node);
+
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneWithSizeClassImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *pushTailOneWithSizeClassImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeOneWithSizeClassImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeFrontOneWithSizeClassImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceWithSizeClassImpl(GraphicsAllocation *node, void *data);
+    GraphicsAllocation *detachNodesWithSizeClassImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceWithSizeClassImpl(GraphicsAllocation *node, void *);
+
+    // allocations of the list grouped by log2 of their size, searched from the class of the requested size up
+    std::array<std::vector<GraphicsAllocation *>, sizeClassCount> sizeClasses;
+    std::atomic<size_t> totalSize{0u};
 };
 } // namespace NEO
@@ -38,4 +38,8 @@ bool DeferrableAllocationDeletion::apply() {
     memoryManager.freeGraphicsMemory(&graphicsAllocation);
     return true;
 }
+
+size_t DeferrableAllocationDeletion::getSize() const {
+    return graphicsAllocation.getUnderlyingBufferSize();
+}
 } // namespace NEO
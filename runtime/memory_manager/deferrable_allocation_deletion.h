@@ -17,6 +17,7 @@ class DeferrableAllocationDeletion : public DeferrableDeletion {
   public:
     DeferrableAllocationDeletion(MemoryManager &memoryManager, GraphicsAllocation &graphicsAllocation);
     bool apply() override;
+    size_t getSize() const override;
 
   protected:
     MemoryManager &memoryManager;
@@ -8,11 +8,14 @@
 #pragma once
 #include "core/utilities/idlist.h"
 
+#include <cstddef>
+
 namespace NEO {
 class DeferrableDeletion : public IDNode<DeferrableDeletion> {
   public:
     template <typename... Args>
     static DeferrableDeletion *create(Args... args);
     virtual bool apply() = 0;
+    virtual size_t getSize() const { return 0u; }
 };
 } // namespace NEO
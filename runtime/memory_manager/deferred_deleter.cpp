@@ -7,6 +7,7 @@
 
 #include "runtime/memory_manager/deferred_deleter.h"
 
+#include "core/debug_settings/debug_settings_manager.h"
 #include "runtime/memory_manager/deferrable_deletion.h"
 #include "runtime/os_interface/os_thread.h"
 
@@ -14,6 +15,8 @@ namespace NEO {
 DeferredDeleter::DeferredDeleter() {
     doWorkInBackground = false;
     elementsToRelease = 0;
+    startedWorkers = 0;
+    retryingThreadActive = false;
 }
 
 void DeferredDeleter::stop() {
@@ -21,19 +24,25 @@ void DeferredDeleter::stop() {
     if (worker != nullptr) {
         // Working thread was created so we can safely stop it
         std::unique_lock<std::mutex> lock(queueMutex);
-        // Make sure that working thread really started
-        while (!doWorkInBackground) {
+        // Make sure that all working threads really started
+        const auto numWorkers = 1u + additionalWorkers.size();
+        while (startedWorkers != numWorkers) {
             lock.unlock();
             lock.lock();
         }
-        // Signal working thread to finish its job
+        // Signal working threads to finish their job
         doWorkInBackground = false;
         lock.unlock();
-        condition.notify_one();
-        // Wait for the working job to exit
+        condition.notify_all();
+        // Wait for the working jobs to exit
         worker->join();
-        // Delete working thread
+        for (auto &additionalWorker : additionalWorkers) {
+            additionalWorker->join();
+        }
+        // Delete working threads
         worker.reset();
+        additionalWorkers.clear();
+        startedWorkers = 0;
     }
     drain(false);
 }
@@ -50,7 +59,11 @@ DeferredDeleter::~DeferredDeleter() {
 void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
     std::unique_lock<std::mutex> lock(queueMutex);
     elementsToRelease++;
-    queue.pushTailOne(*deletion);
+    if (deletion->getSize() >= highPriorityDeletionSize) {
+        highPriorityQueue.pushTailOne(*deletion);
+    } else {
+        queue.pushTailOne(*deletion);
+    }
     lock.unlock();
     condition.notify_one();
 }
@@ -74,6 +87,9 @@ void DeferredDeleter::ensureThread() {
         return;
     }
     worker = Thread::create(run, reinterpret_cast<void *>(this));
+    for (int32_t i = 1; i < DebugManager.flags.DeferredDeleterWorkersCount.get(); i++) {
+        additionalWorkers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
 }
 
 bool DeferredDeleter::areElementsReleased() {
@@ -89,8 +105,9 @@ void *DeferredDeleter::run(void *arg) {
     std::unique_lock<std::mutex> lock(self->queueMutex);
     // Mark that working thread really started
     self->doWorkInBackground = true;
+    self->startedWorkers++;
     do {
-        if (self->queue.peekIsEmpty()) {
+        if (self->arePendingDeletionsEmpty() || self->retryingThreadActive) {
             // Wait for signal that some items are ready to be deleted
             self->condition.wait(lock);
         }
@@ -113,15 +130,74 @@ void DeferredDeleter::drain(bool blocking) {
 }
 
 void DeferredDeleter::clearQueue() {
-    do {
-        auto deletion = queue.removeFrontOne();
-        if (deletion) {
+    size_t bytesFreed = 0;
+    bool retryingDeletions = false;
+    while (true) {
+        // Large deletions release the most memory, fall back to regular ones when none is ready
+        if (applyFrontDeletion(highPriorityQueue, bytesFreed) || applyFrontDeletion(queue, bytesFreed)) {
+            continue;
+        }
+        if (!retryingDeletions) {
+            // Only deletions still in use are left, one thread keeps retrying them
+            // while other workers go back to waiting instead of spinning on the same deletions
+            bool expected = false;
+            if (!retryingThreadActive.compare_exchange_strong(expected, true)) {
+                return;
+            }
+            retryingDeletions = true;
+            continue;
+        }
+        if (arePendingDeletionsEmpty()) {
+            retryingThreadActive = false;
+            retryingDeletions = false;
+            // A thread that gave up while this one was retrying may have handed a deletion back
+            if (arePendingDeletionsEmpty()) {
+                return;
+            }
+        }
+    }
+}
+
+size_t DeferredDeleter::drainUntil(size_t bytesToFree) {
+    size_t bytesFreed = 0;
+    // Workers take and return deletions under the same lock, so the walk sees every pending
+    // deletion not being applied at the moment and leaves the ones still in use in place
+    std::lock_guard<std::mutex> lock(queueMutex);
+    for (auto deletionQueue : {&highPriorityQueue, &queue}) {
+        auto deletion = deletionQueue->peekHead();
+        while (deletion != nullptr && bytesFreed < bytesToFree) {
+            auto next = deletion->next;
+            auto size = deletion->getSize();
             if (deletion->apply()) {
                 elementsToRelease--;
-            } else {
-                queue.pushTailOne(*deletion.release());
+                bytesFreed += size;
+                deletionQueue->removeOne(*deletion);
             }
+            deletion = next;
         }
-    } while (!queue.peekIsEmpty());
+    }
+    return bytesFreed;
+}
+
+bool DeferredDeleter::applyFrontDeletion(DeletionQueue &deletionQueue, size_t &bytesFreed) {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    auto deletion = deletionQueue.removeFrontOne();
+    lock.unlock();
+    if (!deletion) {
+        return false;
+    }
+    auto size = deletion->getSize();
+    if (deletion->apply()) {
+        elementsToRelease--;
+        bytesFreed += size;
+        return true;
+    }
+    lock.lock();
+    deletionQueue.pushTailOne(*deletion.release());
+    return false;
+}
+
+bool DeferredDeleter::arePendingDeletionsEmpty() {
+    return highPriorityQueue.peekIsEmpty() && queue.peekIsEmpty();
 }
 } // namespace NEO
@@ -6,12 +6,15 @@
  */
 
 #pragma once
+#include "core/memory_manager/memory_constants.h"
 #include "core/utilities/idlist.h"
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace NEO {
 class DeferrableDeletion;
@@ -32,11 +35,23 @@ class DeferredDeleter {
 
     MOCKABLE_VIRTUAL void drain(bool blocking);
 
+    // Applies pending deletions that are ready, large ones first, until bytesToFree are released.
+    // Does not wait for allocations still in use, returns number of bytes released.
+    // Runs under the queue lock, so deferring new deletions waits until it is done
+    // and deletions applied here must not defer into this deleter.
+    MOCKABLE_VIRTUAL size_t drainUntil(size_t bytesToFree);
+
+    static constexpr size_t highPriorityDeletionSize = 4 * MemoryConstants::megaByte;
+
   protected:
+    using DeletionQueue = IDList<DeferrableDeletion, true>;
+
     void stop();
     void safeStop();
     void ensureThread();
     MOCKABLE_VIRTUAL void clearQueue();
+    bool applyFrontDeletion(DeletionQueue &deletionQueue, size_t &bytesFreed);
+    bool arePendingDeletionsEmpty();
     MOCKABLE_VIRTUAL bool areElementsReleased();
     MOCKABLE_VIRTUAL bool shouldStop();
 
@@ -44,9 +59,13 @@ class DeferredDeleter {
 
     std::atomic<bool> doWorkInBackground;
     std::atomic<int> elementsToRelease;
+    std::atomic<uint32_t> startedWorkers;
+    std::atomic<bool> retryingThreadActive;
     std::unique_ptr<Thread> worker;
+    std::vector<std::unique_ptr<Thread>> additionalWorkers;
     int32_t numClients = 0;
-    IDList<DeferrableDeletion, true> queue;
+    DeletionQueue queue;
+    DeletionQueue highPriorityQueue;
     std::mutex queueMutex;
     std::mutex threadMutex;
     std::condition_variable condition;
@@ -7,11 +7,17 @@
 
 #include "runtime/memory_manager/internal_allocation_storage.h"
 
+#include "core/helpers/basic_math.h"
+#include "core/helpers/debug_helpers.h"
 #include "core/memory_manager/host_ptr_manager.h"
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/event/event.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/os_context.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace NEO {
 InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver) : commandStreamReceiver(commandStreamReceiver){};
 void InternalAllocationStorage::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage) {
@@ -33,6 +39,13 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
     auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
     allocationsList.pushTailOne(*gfxAllocation.release());
+
+    if (allocationUsage == REUSABLE_ALLOCATION && DebugManager.flags.ReusableAllocationsBudgetInKB.get() != -1) {
+        auto maxTotalSize = static_cast<size_t>(DebugManager.flags.ReusableAllocationsBudgetInKB.get()) * MemoryConstants::kiloByte;
+        if (allocationsForReuse.peekTotalSize() > maxTotalSize) {
+            trimAllocationsForReuse(maxTotalSize);
+        }
+    }
 }
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
@@ -61,8 +74,120 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
     }
 }
 
+void InternalAllocationStorage::trimAllocationsForReuse(size_t maxTotalSize) {
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    auto currentTagValue = *commandStreamReceiver.getTagAddress();
+
+    GraphicsAllocation *curr = allocationsForReuse.detachNodes();
+
+    size_t totalSize = 0u;
+    for (auto allocation = curr; allocation != nullptr; allocation = allocation->next) {
+        totalSize += allocation->getUnderlyingBufferSize();
+    }
+
+    // list is ordered from least recently stored, so oldest completed allocations are released first
+    IDList<GraphicsAllocation, false, true> allocationsLeft;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        if (totalSize > maxTotalSize && curr->getTaskCount(contextId) <= currentTagValue) {
+            auto allocationSize = curr->getUnderlyingBufferSize();
+            totalSize -= allocationSize;
+            reuseStatistics.bytesTrimmed += allocationSize;
+            memoryManager->freeGraphicsMemory(curr);
+        } else {
+            allocationsLeft.pushTailOne(*curr);
+        }
+        curr = next;
+    }
+
+    if (allocationsLeft.peekIsEmpty() == false) {
+        allocationsForReuse.splice(*allocationsLeft.detachNodes());
+    }
+}
+
+GraphicsAllocation *InternalAllocationStorage::obtainHostPtrAllocation(const void *hostPtr, size_t size) {
+    std::lock_guard<std::mutex> lock(hostPtrAllocationsMutex);
+    auto it = hostPtrAllocations.find(reinterpret_cast<uintptr_t>(hostPtr));
+    if (it == hostPtrAllocations.end() || it->second.allocation->getUnderlyingBufferSize() < size) {
+        reuseStatistics.hostPtrMisses++;
+        return nullptr;
+    }
+    reuseStatistics.hostPtrHits++;
+    hostPtrAllocationsLru.splice(hostPtrAllocationsLru.end(), hostPtrAllocationsLru, it->second.lruPosition);
+    // mark as pending under the lock, so eviction cannot free it before the transfer is submitted
+    it->second.allocation->updateTaskCount(Event::eventNotReady, commandStreamReceiver.getOsContext().getContextId());
+    return it->second.allocation;
+}
+
+void InternalAllocationStorage::storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, size_t maxTotalSize) {
+    std::lock_guard<std::mutex> lock(hostPtrAllocationsMutex);
+    auto start = reinterpret_cast<uintptr_t>(gfxAllocation->getUnderlyingBuffer());
+    auto size = gfxAllocation->getUnderlyingBufferSize();
+    releaseHostPtrAllocationsInRange(start, start + size);
+
+    if (size > maxTotalSize) {
+        storeAllocation(std::move(gfxAllocation), TEMPORARY_ALLOCATION);
+        return;
+    }
+
+    // least recently used allocations are passed to the temporary list, which frees them once completed
+    while (hostPtrAllocationsSize + size > maxTotalSize) {
+        releaseHostPtrAllocation(hostPtrAllocations.find(hostPtrAllocationsLru.front()));
+    }
+    auto lruPosition = hostPtrAllocationsLru.insert(hostPtrAllocationsLru.end(), start);
+    hostPtrAllocations.emplace(start, HostPtrAllocationEntry{gfxAllocation.release(), lruPosition});
+    hostPtrAllocationsSize += size;
+}
+
+void InternalAllocationStorage::releaseHostPtrAllocations(const void *ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(hostPtrAllocationsMutex);
+    auto start = reinterpret_cast<uintptr_t>(ptr);
+    releaseHostPtrAllocationsInRange(start, start + size);
+}
+
+void InternalAllocationStorage::releaseHostPtrAllocations() {
+    std::lock_guard<std::mutex> lock(hostPtrAllocationsMutex);
+    for (auto it = hostPtrAllocations.begin(); it != hostPtrAllocations.end();) {
+        it = releaseHostPtrAllocation(it);
+    }
+}
+
+size_t InternalAllocationStorage::getHostPtrAllocationsCount() {
+    std::lock_guard<std::mutex> lock(hostPtrAllocationsMutex);
+    return hostPtrAllocations.size();
+}
+
+void InternalAllocationStorage::releaseHostPtrAllocationsInRange(uintptr_t start, uintptr_t end) {
+    auto it = hostPtrAllocations.lower_bound(start);
+    if (it != hostPtrAllocations.begin()) {
+        auto previous = std::prev(it);
+        if (previous->first + previous->second.allocation->getUnderlyingBufferSize() > start) {
+            it = previous;
+        }
+    }
+    while (it != hostPtrAllocations.end() && it->first < end) {
+        it = releaseHostPtrAllocation(it);
+    }
+}
+
+InternalAllocationStorage::HostPtrAllocationsMap::iterator InternalAllocationStorage::releaseHostPtrAllocation(HostPtrAllocationsMap::iterator it) {
+    auto allocation = it->second.allocation;
+    hostPtrAllocationsSize -= allocation->getUnderlyingBufferSize();
+    hostPtrAllocationsLru.erase(it->second.lruPosition);
+    storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+    return hostPtrAllocations.erase(it);
+}
+
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
     auto allocation = allocationsForReuse.detachAllocation(requiredSize, commandStreamReceiver, allocationType);
+    if (allocation) {
+        reuseStatistics.hits++;
+        reuseStatistics.bytesWasted += allocation->getUnderlyingBufferSize() - requiredSize;
+    } else {
+        reuseStatistics.misses++;
+    }
     return allocation;
 }
 
@@ -86,17 +211,130 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
 
 GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
     ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
-    auto *curr = head;
-    while (curr != nullptr) {
-        auto currentTagValue = *req->csrTagAddress;
-        if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
-            (currentTagValue >= curr->getTaskCount(req->contextId))) {
-            return removeOneImpl(curr, nullptr);
+    auto currentTagValue = *req->csrTagAddress;
+    GraphicsAllocation *bestFit = nullptr;
+    // every allocation of a higher size class is bigger than any of a lower one, so best fit is in the first class with a match
+    for (auto sizeClass = getSizeClass(req->requiredMinimalSize); sizeClass < sizeClassCount && bestFit == nullptr; sizeClass++) {
+        for (auto curr : sizeClasses[sizeClass]) {
+            auto currentSize = curr->getUnderlyingBufferSize();
+            if ((req->allocationType == curr->getAllocationType()) &&
+                (currentSize >= req->requiredMinimalSize) &&
+                (currentTagValue >= curr->getTaskCount(req->contextId))) {
+                if (currentSize == req->requiredMinimalSize) {
+                    bestFit = curr;
+                    break;
+                }
+                if (bestFit == nullptr || currentSize < bestFit->getUnderlyingBufferSize()) {
+                    bestFit = curr;
+                }
+            }
         }
-        curr = curr->next;
     }
+    if (bestFit) {
+        return removeOneWithSizeClassImpl(bestFit, nullptr);
+    }
+    return nullptr;
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneWithSizeClassImpl>(&node);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneWithSizeClassImpl>(&node);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &node) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneWithSizeClassImpl>(&node));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneWithSizeClassImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceWithSizeClassImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesWithSizeClassImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &nodes) {
+    processLocked<AllocationsList, &AllocationsList::spliceWithSizeClassImpl>(&nodes);
+}
+
+void AllocationsList::deleteAll() {
+    GraphicsAllocation *nodes = detachNodes();
+    nodes->deleteThisAndAllNext();
+}
+
+uint32_t AllocationsList::getSizeClass(size_t size) {
+    return (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
+void AllocationsList::addToSizeClass(GraphicsAllocation &node) {
+    sizeClasses[getSizeClass(node.getUnderlyingBufferSize())].push_back(&node);
+    totalSize += node.getUnderlyingBufferSize();
+}
+
+void AllocationsList::removeFromSizeClass(GraphicsAllocation &node) {
+    auto &sizeClass = sizeClasses[getSizeClass(node.getUnderlyingBufferSize())];
+    auto it = std::find(sizeClass.begin(), sizeClass.end(), &node);
+    DEBUG_BREAK_IF(it == sizeClass.end());
+    if (it != sizeClass.end()) {
+        *it = sizeClass.back();
+        sizeClass.pop_back();
+        totalSize -= node.getUnderlyingBufferSize();
+    }
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneWithSizeClassImpl(GraphicsAllocation *node, void *) {
+    pushFrontOneImpl(node, nullptr);
+    addToSizeClass(*node);
     return nullptr;
 }
 
+GraphicsAllocation *AllocationsList::pushTailOneWithSizeClassImpl(GraphicsAllocation *node, void *) {
+    pushTailOneImpl(node, nullptr);
+    addToSizeClass(*node);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::removeOneWithSizeClassImpl(GraphicsAllocation *node, void *) {
+    removeFromSizeClass(*node);
+    return removeOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneWithSizeClassImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneWithSizeClassImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceWithSizeClassImpl(GraphicsAllocation *node, void *data) {
+    auto last = static_cast<GraphicsAllocation *>(data);
+    for (auto curr = node; curr != last; curr = curr->next) {
+        removeFromSizeClass(*curr);
+    }
+    removeFromSizeClass(*last);
+    return detachSequenceImpl(node, data);
+}
+
+GraphicsAllocation *AllocationsList::detachNodesWithSizeClassImpl(GraphicsAllocation *, void *) {
+    for (auto &sizeClass : sizeClasses) {
+        sizeClass.clear();
+    }
+    totalSize = 0u;
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceWithSizeClassImpl(GraphicsAllocation *node, void *) {
+    for (auto curr = node; curr != nullptr; curr = curr->next) {
+        addToSizeClass(*curr);
+    }
+    return spliceImpl(node, nullptr);
+}
+
 } // namespace NEO
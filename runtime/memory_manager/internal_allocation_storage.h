@@ -8,9 +8,23 @@
 #pragma once
 #include "runtime/memory_manager/allocations_list.h"
 
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+
 namespace NEO {
 class CommandStreamReceiver;
 
+struct ReuseStatistics {
+    std::atomic<uint64_t> hits{0u};
+    std::atomic<uint64_t> misses{0u};
+    std::atomic<uint64_t> bytesWasted{0u};
+    std::atomic<uint64_t> bytesTrimmed{0u};
+    std::atomic<uint64_t> hostPtrHits{0u};
+    std::atomic<uint64_t> hostPtrMisses{0u};
+};
+
 class InternalAllocationStorage {
   public:
     MOCKABLE_VIRTUAL ~InternalAllocationStorage() = default;
@@ -19,14 +33,37 @@ class InternalAllocationStorage {
     void storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage);
     void storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage, uint32_t taskCount);
     std::unique_ptr<GraphicsAllocation> obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType);
+    void trimAllocationsForReuse(size_t maxTotalSize);
+    GraphicsAllocation *obtainHostPtrAllocation(const void *hostPtr, size_t size);
+    void storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, size_t maxTotalSize);
+    void releaseHostPtrAllocations(const void *ptr, size_t size);
+    void releaseHostPtrAllocations();
+    size_t getHostPtrAllocationsCount();
     AllocationsList &getTemporaryAllocations() { return temporaryAllocations; }
     AllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
+    const ReuseStatistics &peekReuseStatistics() const { return reuseStatistics; }
 
   protected:
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
+    struct HostPtrAllocationEntry {
+        GraphicsAllocation *allocation;
+        std::list<uintptr_t>::iterator lruPosition;
+    };
+    using HostPtrAllocationsMap = std::map<uintptr_t, HostPtrAllocationEntry>;
+
+    void releaseHostPtrAllocationsInRange(uintptr_t start, uintptr_t end);
+    HostPtrAllocationsMap::iterator releaseHostPtrAllocation(HostPtrAllocationsMap::iterator it);
     CommandStreamReceiver &commandStreamReceiver;
 
     AllocationsList temporaryAllocations;
     AllocationsList allocationsForReuse;
+    ReuseStatistics reuseStatistics;
+
+    // EXTERNAL_HOST_PTR allocations kept alive between transfers, keyed by host pointer; ranges never overlap
+    HostPtrAllocationsMap hostPtrAllocations;
+    // keys of hostPtrAllocations, least recently used first
+    std::list<uintptr_t> hostPtrAllocationsLru;
+    size_t hostPtrAllocationsSize = 0u;
+    std::mutex hostPtrAllocationsMutex;
 };
 } // namespace NEO
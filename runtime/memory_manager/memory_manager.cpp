@@ -194,6 +194,7 @@ bool MemoryManager::isMemoryBudgetExhausted() const {
 
 OsContext *MemoryManager::createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver, aub_stream::EngineType engineType,
                                                      DeviceBitfield deviceBitfield, PreemptionMode preemptionMode, bool lowPriority) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     auto contextId = ++latestContextId;
     auto osContext = OsContext::create(peekExecutionEnvironment().osInterface.get(), contextId, deviceBitfield, engineType, preemptionMode, lowPriority);
     osContext->incRefInternal();
@@ -384,11 +385,26 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryForImage(const Allocati
     return allocateGraphicsMemoryForImageImpl(allocationDataWithSize, std::move(gmm));
 }
 
-EngineControlContainer &MemoryManager::getRegisteredEngines() {
+EngineControlContainer MemoryManager::getRegisteredEngines() const {
+    // engines may be registered from other threads (parallel or lazy engine creation),
+    // readers iterate over a copy instead of the vector that may reallocate
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     return registeredEngines;
 }
 
+uint32_t MemoryManager::getRegisteredEnginesCount() const {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
+    return static_cast<uint32_t>(registeredEngines.size());
+}
+
+void MemoryManager::registerEngineForCsr(CommandStreamReceiver *commandStreamReceiver, OsContext *osContext) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
+    osContext->incRefInternal();
+    registeredEngines.emplace_back(commandStreamReceiver, osContext);
+}
+
 EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     EngineControl *engineCtrl = nullptr;
     for (auto &engine : registeredEngines) {
         if (engine.commandStreamReceiver == commandStreamReceiver) {
@@ -400,17 +416,38 @@ EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *c
 }
 
 void MemoryManager::unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
     auto numRegisteredEngines = registeredEngines.size();
     for (auto i = 0u; i < numRegisteredEngines; i++) {
         if (registeredEngines[i].commandStreamReceiver == commandStreamReceiver) {
-            registeredEngines[i].osContext->decRefInternal();
+            auto osContext = registeredEngines[i].osContext;
             std::swap(registeredEngines[i], registeredEngines[numRegisteredEngines - 1]);
             registeredEngines.pop_back();
+            if (osContext == defaultEngineContext &&
+                std::none_of(registeredEngines.begin(), registeredEngines.end(), [osContext](const EngineControl &engine) { return engine.osContext == osContext; })) {
+                defaultEngineContext = nullptr;
+            }
+            osContext->decRefInternal();
             return;
         }
     }
 }
 
+void MemoryManager::setDefaultEngineContext(OsContext *osContext) {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
+    if (defaultEngineContext == nullptr) {
+        defaultEngineContext = osContext;
+    }
+}
+
+OsContext *MemoryManager::getDefaultEngineContext() const {
+    std::lock_guard<std::mutex> lock(registeredEnginesMutex);
+    if (defaultEngineContext == nullptr && !registeredEngines.empty()) {
+        return registeredEngines[0].osContext;
+    }
+    return defaultEngineContext;
+}
+
 void *MemoryManager::lockResource(GraphicsAllocation *graphicsAllocation) {
     if (!graphicsAllocation) {
         return nullptr;
@@ -476,6 +513,8 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
 void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
     for (auto &engine : getRegisteredEngines()) {
         auto csr = engine.commandStreamReceiver;
+        // cached host pointer allocations may hold fragments overlapping the new host pointer
+        csr->getInternalAllocationStorage()->releaseHostPtrAllocations();
         if (waitForCompletion) {
             csr->waitForCompletionWithTimeout(false, 0, csr->peekLatestSentTaskCount());
         }
@@ -483,6 +522,14 @@ void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForComplet
     }
 }
 
+void MemoryManager::releaseHostPtrAllocationsOnAllEngines(const void *ptr, size_t size) {
+    for (auto &engine : getRegisteredEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        csr->getInternalAllocationStorage()->releaseHostPtrAllocations(ptr, size);
+        csr->getInternalAllocationStorage()->cleanAllocationList(*csr->getTagAddress(), AllocationUsage::TEMPORARY_ALLOCATION);
+    }
+}
+
 void *MemoryManager::getReservedMemory(size_t size, size_t alignment) {
     static std::mutex mutex;
     std::lock_guard<std::mutex> lock(mutex);
@@ -122,6 +122,7 @@ class MemoryManager {
     void waitForDeletions();
     void waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation);
     void cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion);
+    void releaseHostPtrAllocationsOnAllEngines(const void *ptr, size_t size);
 
     bool isAsyncDeleterEnabled() const;
     bool isLocalMemorySupported() const;
@@ -145,12 +146,14 @@ class MemoryManager {
 
     OsContext *createAndRegisterOsContext(CommandStreamReceiver *commandStreamReceiver, aub_stream::EngineType engineType,
                                           DeviceBitfield deviceBitfield, PreemptionMode preemptionMode, bool lowPriority);
-    uint32_t getRegisteredEnginesCount() const { return static_cast<uint32_t>(registeredEngines.size()); }
-    EngineControlContainer &getRegisteredEngines();
+    uint32_t getRegisteredEnginesCount() const;
+    EngineControlContainer getRegisteredEngines() const;
+    void registerEngineForCsr(CommandStreamReceiver *commandStreamReceiver, OsContext *osContext);
     EngineControl *getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     void unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     HostPtrManager *getHostPtrManager() const { return hostPtrManager.get(); }
-    void setDefaultEngineIndex(uint32_t index) { defaultEngineIndex = index; }
+    void setDefaultEngineContext(OsContext *osContext);
+    OsContext *getDefaultEngineContext() const;
     virtual bool copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, const void *memoryToCopy, size_t sizeToCopy);
     static HeapIndex selectHeap(const GraphicsAllocation *allocation, bool hasPointer, bool isFullRangeSVM);
     static std::unique_ptr<MemoryManager> createMemoryManager(ExecutionEnvironment &executionEnvironment);
@@ -225,9 +228,10 @@ class MemoryManager {
     bool supportsMultiStorageResources = true;
     ExecutionEnvironment &executionEnvironment;
     EngineControlContainer registeredEngines;
+    mutable std::mutex registeredEnginesMutex;
     std::unique_ptr<HostPtrManager> hostPtrManager;
     uint32_t latestContextId = std::numeric_limits<uint32_t>::max();
-    uint32_t defaultEngineIndex = 0;
+    OsContext *defaultEngineContext = nullptr;
     std::unique_ptr<DeferredDeleter> multiContextResourceDestructor;
     std::vector<std::unique_ptr<GfxPartition>> gfxPartitions;
     std::unique_ptr<LocalMemoryUsageBankSelector> localMemoryUsageBankSelector;
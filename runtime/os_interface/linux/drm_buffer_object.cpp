@@ -72,6 +72,15 @@ int BufferObject::wait(int64_t timeoutNs) {
     return ret;
 }
 
+bool BufferObject::isBusy() {
+    drm_i915_gem_busy busy = {};
+    busy.handle = this->handle;
+
+    int ret = this->drm->ioctl(DRM_IOCTL_I915_GEM_BUSY, &busy);
+    // object of unknown state is treated as busy, so callers fall back to waiting on it
+    return (ret != 0) || (busy.busy != 0);
+}
+
 bool BufferObject::setTiling(uint32_t mode, uint32_t stride) {
     if (this->tiling_mode == mode) {
         return true;
@@ -102,15 +111,26 @@ void BufferObject::fillExecObject(drm_i915_gem_exec_object2 &execObject, uint32_
     execObject.rsvd2 = 0;
 }
 
+bool BufferObject::isExecObjectUpToDate(const drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) const {
+    // all remaining fields are constant for soft-pinned objects
+    return execObject.handle == static_cast<uint32_t>(this->handle) &&
+           execObject.offset == this->gpuAddress &&
+           execObject.rsvd1 == drmContextId;
+}
+
 int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage) {
     for (size_t i = 0; i < residencyCount; i++) {
         residency[i]->fillExecObject(execObjectsStorage[i], drmContextId);
     }
     this->fillExecObject(execObjectsStorage[residencyCount], drmContextId);
 
+    return this->submitExecObjects(used, startOffset, flags, drmContextId, execObjectsStorage, residencyCount + 1u);
+}
+
+int BufferObject::submitExecObjects(uint32_t used, size_t startOffset, unsigned int flags, uint32_t drmContextId, drm_i915_gem_exec_object2 *execObjects, size_t execObjectsCount) {
     drm_i915_gem_execbuffer2 execbuf{};
-    execbuf.buffers_ptr = reinterpret_cast<uintptr_t>(execObjectsStorage);
-    execbuf.buffer_count = static_cast<uint32_t>(residencyCount + 1u);
+    execbuf.buffers_ptr = reinterpret_cast<uintptr_t>(execObjects);
+    execbuf.buffer_count = static_cast<uint32_t>(execObjectsCount);
     execbuf.batch_start_offset = static_cast<uint32_t>(startOffset);
     execbuf.batch_len = alignUp(used, 8);
     execbuf.flags = flags;
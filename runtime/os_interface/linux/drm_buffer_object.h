@@ -6,6 +6,9 @@
  */
 
 #pragma once
+#include "core/memory_manager/definitions/engine_limits.h"
+
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <stdint.h>
@@ -15,10 +18,12 @@ struct drm_i915_gem_relocation_entry;
 
 namespace NEO {
 
+class DrmGemCloseWorker;
 class DrmMemoryManager;
 class Drm;
 
 class BufferObject {
+    friend DrmGemCloseWorker;
     friend DrmMemoryManager;
 
   public:
@@ -31,8 +36,13 @@ class BufferObject {
     MOCKABLE_VIRTUAL int pin(BufferObject *const boToPin[], size_t numberOfBos, uint32_t drmContextId);
 
     int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage);
+    int submitExecObjects(uint32_t used, size_t startOffset, unsigned int flags, uint32_t drmContextId, drm_i915_gem_exec_object2 *execObjects, size_t execObjectsCount);
+
+    MOCKABLE_VIRTUAL void fillExecObject(drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId);
+    bool isExecObjectUpToDate(const drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) const;
 
     int wait(int64_t timeoutNs);
+    bool isBusy();
     bool close();
 
     inline void reference() {
@@ -51,6 +61,18 @@ class BufferObject {
     bool peekIsReusableAllocation() const { return this->isReused; }
     uint32_t peekRootDeviceIndex() { return rootDeviceIndex; }
 
+    uint64_t peekResidencyEpoch(uint32_t osContextId) const {
+        if (osContextId < residencyEpochs.size()) {
+            return residencyEpochs[osContextId];
+        }
+        return 0u;
+    }
+    void setResidencyEpoch(uint32_t osContextId, uint64_t epoch) {
+        if (osContextId < residencyEpochs.size()) {
+            residencyEpochs[osContextId] = epoch;
+        }
+    }
+
   protected:
     Drm *drm;
 
@@ -64,12 +86,16 @@ class BufferObject {
     //Tiling
     uint32_t tiling_mode;
 
-    MOCKABLE_VIRTUAL void fillExecObject(drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId);
-
     uint64_t gpuAddress = 0llu;
 
     void *lockedAddress; // CPU side virtual address
 
     uint64_t unmapSize = 0;
+
+    // epoch of the residency list this object was last added to, per os context
+    std::array<uint64_t, maxOsContextCount> residencyEpochs = {};
+
+    // link in gem close worker pending list
+    BufferObject *nextToClose = nullptr;
 };
 } // namespace NEO
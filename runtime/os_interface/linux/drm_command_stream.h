@@ -49,16 +49,24 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
         return this->gemCloseWorkerOperationMode;
     }
 
+    uint64_t peekExecObjectsReusedCount() const { return execObjectsReusedCount; }
+    uint64_t peekExecObjectsFilledCount() const { return execObjectsFilledCount; }
+
   protected:
     void makeResidentBufferObjects(const DrmAllocation *drmAllocation);
     void makeResident(BufferObject *bo);
     void flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency);
     void exec(const BatchBuffer &batchBuffer, uint32_t drmContextId);
+    void clearResidency();
+    void updateExecObject(BufferObject &bo, drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId);
 
     std::vector<BufferObject *> residency;
+    uint64_t residencyEpoch = 1u;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
     uint32_t handleIndex = 0u;
+    uint64_t execObjectsReusedCount = 0u;
+    uint64_t execObjectsFilledCount = 0u;
 };
 } // namespace NEO
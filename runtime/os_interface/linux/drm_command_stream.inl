@@ -22,7 +22,9 @@
 #include "runtime/os_interface/linux/os_context_linux.h"
 #include "runtime/os_interface/linux/os_interface.h"
 #include "runtime/platform/platform.h"
+#include "runtime/utilities/enqueue_phase_profiler.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -43,6 +45,7 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
 
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    EnqueuePhaseScope phaseScope(EnqueuePhase::Flush);
     DrmAllocation *alloc = static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation);
     DEBUG_BREAK_IF(!alloc);
 
@@ -83,28 +86,54 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
         this->execObjectsStorage.resize(requiredSize);
     }
 
-    int err = bb->exec(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
-                       batchBuffer.startOffset, engineFlag | I915_EXEC_NO_RELOC,
-                       batchBuffer.requiresCoherency,
-                       drmContextId,
-                       this->residency.data(), this->residency.size(),
-                       this->execObjectsStorage.data());
+    // Exec objects are kept between submissions, only entries that differ from the previous flush are rewritten
+    const auto residencyCount = this->residency.size();
+    for (size_t i = 0; i < residencyCount; i++) {
+        updateExecObject(*this->residency[i], this->execObjectsStorage[i], drmContextId);
+    }
+    updateExecObject(*bb, this->execObjectsStorage[residencyCount], drmContextId);
+
+    int err = bb->submitExecObjects(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
+                                    batchBuffer.startOffset, engineFlag | I915_EXEC_NO_RELOC,
+                                    drmContextId,
+                                    this->execObjectsStorage.data(), residencyCount + 1u);
     UNRECOVERABLE_IF(err != 0);
 
+    clearResidency();
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::updateExecObject(BufferObject &bo, drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) {
+    if (bo.isExecObjectUpToDate(execObject, drmContextId)) {
+        execObjectsReusedCount++;
+        return;
+    }
+    bo.fillExecObject(execObject, drmContextId);
+    execObjectsFilledCount++;
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::clearResidency() {
+    // Bumping the epoch invalidates residency stamps of all buffer objects in one step
     this->residency.clear();
+    this->residencyEpoch++;
 }
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     if (bo) {
+        const auto osContextId = osContext->getContextId();
         if (bo->peekIsReusableAllocation()) {
-            for (auto bufferObject : this->residency) {
-                if (bufferObject == bo) {
+            if (osContextId >= maxOsContextCount) {
+                if (std::find(this->residency.begin(), this->residency.end(), bo) != this->residency.end()) {
                     return;
                 }
+            } else if (bo->peekResidencyEpoch(osContextId) == this->residencyEpoch) {
+                return;
             }
         }
 
+        bo->setResidencyEpoch(osContextId, this->residencyEpoch);
         residency.push_back(bo);
     }
 }
@@ -134,7 +163,7 @@ void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gf
     // If makeNonResident is called before flush, vector will be cleared.
     if (gfxAllocation.isResident(this->osContext->getContextId())) {
         if (this->residency.size() != 0) {
-            this->residency.clear();
+            clearResidency();
         }
         for (auto fragmentId = 0u; fragmentId < gfxAllocation.fragmentsStorage.fragmentCount; fragmentId++) {
             gfxAllocation.fragmentsStorage.fragmentStorageData[fragmentId].residency->resident[osContext->getContextId()] = false;
@@ -15,7 +15,6 @@
 
 #include <atomic>
 #include <iostream>
-#include <queue>
 #include <stdio.h>
 
 namespace NEO {
@@ -41,11 +40,21 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 }
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
-    std::unique_lock<std::mutex> lock(closeWorkerMutex);
-    workCount++;
-    queue.push(bo);
-    lock.unlock();
-    condition.notify_one();
+    auto queueDepth = ++workCount;
+    auto currentMax = maxQueueDepth.load();
+    while (queueDepth > currentMax && !maxQueueDepth.compare_exchange_weak(currentMax, queueDepth)) {
+    }
+
+    auto head = pendingObjects.load(std::memory_order_relaxed);
+    do {
+        bo->nextToClose = head;
+    } while (!pendingObjects.compare_exchange_weak(head, bo, std::memory_order_release, std::memory_order_relaxed));
+
+    // worker sleeps only on empty list, wake it up on first push
+    if (head == nullptr) {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
@@ -61,46 +70,55 @@ bool DrmGemCloseWorker::isEmpty() {
 }
 
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
-    bo->wait(-1);
     memoryManager.unreference(bo, false);
     workCount--;
 }
 
+void DrmGemCloseWorker::closePendingObjects() {
+    auto newest = pendingObjects.exchange(nullptr, std::memory_order_acquire);
+    if (newest == nullptr) {
+        return;
+    }
+    batchCount++;
+
+    // Objects are released in submission order, so by the time the most recently pushed one is idle
+    // older objects are usually idle too. Only objects still reported busy are waited on again.
+    newest->wait(-1);
+
+    BufferObject *oldest = nullptr;
+    for (auto bo = newest; bo != nullptr;) {
+        auto next = bo->nextToClose;
+        bo->nextToClose = oldest;
+        oldest = bo;
+        bo = next;
+    }
+
+    for (auto bo = oldest; bo != nullptr;) {
+        auto next = bo->nextToClose;
+        if (bo != newest && bo->isBusy()) {
+            bo->wait(-1);
+            fallbackWaitCount++;
+        }
+        close(bo);
+        bo = next;
+    }
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
-    std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
-    lock.unlock();
+    std::unique_lock<std::mutex> lock(self->closeWorkerMutex, std::defer_lock);
 
     while (self->active) {
         lock.lock();
-        workItem = nullptr;
-
-        while (self->queue.empty() && self->active) {
+        while (self->pendingObjects.load() == nullptr && self->active) {
             self->condition.wait(lock);
         }
-
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
-
         lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
-    }
 
-    lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
+        self->closePendingObjects();
     }
 
-    lock.unlock();
+    self->closePendingObjects();
     self->workerDone.store(true);
     return nullptr;
 }
@@ -10,8 +10,8 @@
 #include <condition_variable>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <set>
 
 namespace NEO {
@@ -37,16 +37,26 @@ class DrmGemCloseWorker {
 
     bool isEmpty();
 
+    uint32_t getQueueDepth() const { return workCount.load(); }
+    uint32_t peekMaxQueueDepth() const { return maxQueueDepth.load(); }
+    uint64_t peekBatchCount() const { return batchCount.load(); }
+    uint64_t peekFallbackWaitCount() const { return fallbackWaitCount.load(); }
+
   protected:
     void close(BufferObject *workItem);
+    void closePendingObjects();
     void closeThread();
     static void *worker(void *arg);
-    bool active = true;
+    std::atomic<bool> active{true};
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    // pushed objects form a lock-free stack, most recently pushed first
+    std::atomic<BufferObject *> pendingObjects{nullptr};
     std::atomic<uint32_t> workCount{0};
+    std::atomic<uint32_t> maxQueueDepth{0};
+    std::atomic<uint64_t> batchCount{0};
+    std::atomic<uint64_t> fallbackWaitCount{0};
 
     DrmMemoryManager &memoryManager;
 
@@ -721,7 +721,7 @@ int DrmMemoryManager::obtainFdFromHandle(int boHandle) {
 }
 
 uint32_t DrmMemoryManager::getDefaultDrmContextId() const {
-    auto osContextLinux = static_cast<OsContextLinux *>(registeredEngines[defaultEngineIndex].osContext);
+    auto osContextLinux = static_cast<OsContextLinux *>(getDefaultEngineContext());
     return osContextLinux->getDrmContextIds()[0];
 }
 
@@ -15,10 +15,10 @@ template <typename... Args>
 DeferrableDeletion *DeferrableDeletion::create(Args... args) {
     return new DeferrableDeletionImpl(std::forward<Args>(args)...);
 }
-template DeferrableDeletion *DeferrableDeletion::create(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
+template DeferrableDeletion *DeferrableDeletion::create(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size);
 
-DeferrableDeletionImpl::DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle)
-    : wddm(wddm), allocationCount(allocationCount), resourceHandle(resourceHandle) {
+DeferrableDeletionImpl::DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size)
+    : wddm(wddm), allocationCount(allocationCount), resourceHandle(resourceHandle), size(size) {
     if (handles) {
         this->handles = new D3DKMT_HANDLE[allocationCount];
         for (uint32_t i = 0; i < allocationCount; i++) {
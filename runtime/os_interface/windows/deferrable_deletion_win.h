@@ -19,8 +19,9 @@ class Wddm;
 
 class DeferrableDeletionImpl : public DeferrableDeletion {
   public:
-    DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
+    DeferrableDeletionImpl(Wddm *wddm, const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size);
     bool apply() override;
+    size_t getSize() const override { return size; }
     ~DeferrableDeletionImpl();
 
     DeferrableDeletionImpl(const DeferrableDeletionImpl &) = delete;
@@ -31,5 +32,6 @@ class DeferrableDeletionImpl : public DeferrableDeletion {
     D3DKMT_HANDLE *handles = nullptr;
     uint32_t allocationCount;
     D3DKMT_HANDLE resourceHandle;
+    size_t size;
 };
 } // namespace NEO
@@ -33,6 +33,7 @@
 #include "runtime/platform/platform.h"
 
 #include <algorithm>
+#include <limits>
 
 namespace NEO {
 
@@ -325,7 +326,7 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
     WddmAllocation *input = static_cast<WddmAllocation *>(gfxAllocation);
     DEBUG_BREAK_IF(!validateAllocation(input));
 
-    for (auto &engine : this->registeredEngines) {
+    for (auto &engine : getRegisteredEngines()) {
         auto &residencyController = static_cast<OsContextWin *>(engine.osContext)->getResidencyController();
         auto lock = residencyController.acquireLock();
         residencyController.removeFromTrimCandidateListIfUsed(input, true);
@@ -359,7 +360,7 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
             allocationHandles = input->getHandles().data();
             allocationCount = input->getNumHandles();
         }
-        auto status = tryDeferDeletions(allocationHandles, allocationCount, resourceHandle);
+        auto status = tryDeferDeletions(allocationHandles, allocationCount, resourceHandle, input->getUnderlyingBufferSize());
         DEBUG_BREAK_IF(!status);
         alignedFreeWrapper(input->getDriverAllocatedCpuPtr());
     }
@@ -374,7 +375,7 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
 
 void WddmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
     auto wddmAllocation = static_cast<WddmAllocation *>(allocation);
-    for (auto &engine : this->registeredEngines) {
+    for (auto &engine : getRegisteredEngines()) {
         const auto lastFenceValue = wddmAllocation->getResidencyData().getFenceValueForContextId(engine.osContext->getContextId());
         if (lastFenceValue != 0u) {
             const auto &monitoredFence = static_cast<OsContextWin *>(engine.osContext)->getResidencyController().getMonitoredFence();
@@ -384,10 +385,10 @@ void WddmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
     }
 }
 
-bool WddmMemoryManager::tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle) {
+bool WddmMemoryManager::tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size) {
     bool status = true;
     if (deferredDeleter) {
-        deferredDeleter->deferDeletion(DeferrableDeletion::create(wddm, handles, allocationCount, resourceHandle));
+        deferredDeleter->deferDeletion(DeferrableDeletion::create(wddm, handles, allocationCount, resourceHandle, size));
     } else {
         status = wddm->destroyAllocations(handles, allocationCount, resourceHandle);
     }
@@ -395,8 +396,12 @@ bool WddmMemoryManager::tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t
 }
 
 bool WddmMemoryManager::isMemoryBudgetExhausted() const {
-    for (auto &engine : this->registeredEngines) {
+    for (auto &engine : getRegisteredEngines()) {
         if (static_cast<OsContextWin *>(engine.osContext)->getResidencyController().isMemoryBudgetExhausted()) {
+            if (deferredDeleter) {
+                // give back memory of deletions that are already ready before the caller starts flushing
+                deferredDeleter->drainUntil(std::numeric_limits<size_t>::max());
+            }
             return true;
         }
     }
@@ -446,15 +451,17 @@ void WddmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage, uint32_t
 
     D3DKMT_HANDLE handles[maxFragmentsCount] = {0};
     auto allocationCount = 0;
+    size_t fragmentsSize = 0;
 
     for (unsigned int i = 0; i < maxFragmentsCount; i++) {
         if (handleStorage.fragmentStorageData[i].freeTheFragment) {
             handles[allocationCount++] = handleStorage.fragmentStorageData[i].osHandleStorage->handle;
+            fragmentsSize += handleStorage.fragmentStorageData[i].fragmentSize;
             std::fill_n(handleStorage.fragmentStorageData[i].residency->resident, maxOsContextCount, false);
         }
     }
 
-    bool success = tryDeferDeletions(handles, allocationCount, 0);
+    bool success = tryDeferDeletions(handles, allocationCount, 0, fragmentsSize);
 
     for (unsigned int i = 0; i < maxFragmentsCount; i++) {
         if (handleStorage.fragmentStorageData[i].freeTheFragment) {
@@ -542,8 +549,15 @@ bool WddmMemoryManager::createGpuAllocationsWithRetry(WddmAllocation *allocation
     for (auto handleId = 0u; handleId < allocation->getNumHandles(); handleId++) {
         auto status = wddm->createAllocation(allocation->getAlignedCpuPtr(), allocation->getGmm(handleId), allocation->getHandleToModify(handleId), allocation->shareable);
         if (status == STATUS_GRAPHICS_NO_VIDEO_MEMORY && deferredDeleter) {
-            deferredDeleter->drain(true);
-            status = wddm->createAllocation(allocation->getAlignedCpuPtr(), allocation->getGmm(handleId), allocation->getHandleToModify(handleId), allocation->shareable);
+            // try to release just enough memory before waiting for all pending deletions
+            auto requiredSize = static_cast<size_t>(allocation->getGmm(handleId)->gmmResourceInfo->getSizeAllocation());
+            if (deferredDeleter->drainUntil(requiredSize) >= requiredSize) {
+                status = wddm->createAllocation(allocation->getAlignedCpuPtr(), allocation->getGmm(handleId), allocation->getHandleToModify(handleId), allocation->shareable);
+            }
+            if (status == STATUS_GRAPHICS_NO_VIDEO_MEMORY) {
+                deferredDeleter->drain(true);
+                status = wddm->createAllocation(allocation->getAlignedCpuPtr(), allocation->getGmm(handleId), allocation->getHandleToModify(handleId), allocation->shareable);
+            }
         }
         if (status != STATUS_SUCCESS) {
             wddm->destroyAllocations(allocation->getHandles().data(), handleId, allocation->resourceHandle);
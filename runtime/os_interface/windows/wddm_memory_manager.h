@@ -50,7 +50,7 @@ class WddmMemoryManager : public MemoryManager {
     uint64_t getSystemSharedMemory() override;
     uint64_t getLocalMemorySize() override;
 
-    bool tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle);
+    bool tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, size_t size);
 
     bool isMemoryBudgetExhausted() const override;
 
@@ -12,6 +12,7 @@
 #include "core/execution_environment/root_device_environment.h"
 #include "core/gmm_helper/gmm_helper.h"
 #include "core/helpers/debug_helpers.h"
+#include "core/helpers/file_io.h"
 #include "core/helpers/hw_helper.h"
 #include "core/helpers/options.h"
 #include "core/helpers/string.h"
@@ -32,6 +33,11 @@
 #include "CL/cl_ext.h"
 #include "gmm_client_context.h"
 
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
 namespace NEO {
 
 std::unique_ptr<Platform> platformImpl;
@@ -122,6 +128,71 @@ const std::string &Platform::peekCompilerExtensions() const {
     return compilerExtensions;
 }
 
+namespace {
+uint64_t elapsedMicroseconds(std::chrono::steady_clock::time_point &since) {
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - since).count();
+    since = now;
+    return static_cast<uint64_t>(elapsed);
+}
+} // namespace
+
+void Platform::createRootDevices(size_t numRootDevices) {
+    this->devices.resize(numRootDevices);
+    if (!DebugManager.flags.ParallelDeviceInitialization.get() || numRootDevices < 2) {
+        for (uint32_t deviceOrdinal = 0; deviceOrdinal < numRootDevices; ++deviceOrdinal) {
+            this->devices[deviceOrdinal] = createRootDevice(deviceOrdinal);
+            if (!this->devices[deviceOrdinal]) {
+                break;
+            }
+        }
+        return;
+    }
+
+    // state shared by all devices has to exist before devices are created concurrently
+    if (!executionEnvironment->sourceLevelDebugger) {
+        executionEnvironment->initSourceLevelDebugger();
+    }
+
+    std::vector<std::thread> deviceThreads;
+    for (uint32_t deviceOrdinal = 1; deviceOrdinal < numRootDevices; ++deviceOrdinal) {
+        deviceThreads.emplace_back([this, deviceOrdinal]() {
+            this->devices[deviceOrdinal] = createRootDevice(deviceOrdinal);
+        });
+    }
+    this->devices[0] = createRootDevice(0);
+    for (auto &deviceThread : deviceThreads) {
+        deviceThread.join();
+    }
+}
+
+void Platform::reportInitializationTimes() const {
+    printDebugString(DebugManager.flags.PrintPlatformInitializationTimes.get(), stdout,
+                     "Platform initialization times [us]: getDevices %llu, memoryManager %llu, gmm %llu, devices %llu, engines %llu, sipKernel %llu, total %llu\n",
+                     static_cast<unsigned long long>(initializationTimes.getDevices),
+                     static_cast<unsigned long long>(initializationTimes.memoryManager),
+                     static_cast<unsigned long long>(initializationTimes.gmm),
+                     static_cast<unsigned long long>(initializationTimes.devices),
+                     static_cast<unsigned long long>(initializationTimes.engines),
+                     static_cast<unsigned long long>(initializationTimes.sipKernel),
+                     static_cast<unsigned long long>(initializationTimes.total));
+
+    auto timesFileName = DebugManager.flags.PlatformInitializationTimesFile.get();
+    if (timesFileName != "unk") {
+        std::stringstream json;
+        json << "{\"getDevices\": " << initializationTimes.getDevices
+             << ", \"memoryManager\": " << initializationTimes.memoryManager
+             << ", \"gmm\": " << initializationTimes.gmm
+             << ", \"devices\": " << initializationTimes.devices
+             << ", \"engines\": " << initializationTimes.engines
+             << ", \"sipKernel\": " << initializationTimes.sipKernel
+             << ", \"total\": " << initializationTimes.total
+             << ", \"numDevices\": " << devices.size() << "}\n";
+        auto jsonString = json.str();
+        writeDataToFile(timesFileName.c_str(), jsonString.c_str(), jsonString.size());
+    }
+}
+
 bool Platform::initialize() {
     size_t numDevicesReturned = 0;
 
@@ -136,7 +207,12 @@ bool Platform::initialize() {
             this->initializationLoopHelper();
     }
 
+    auto initializationStart = std::chrono::steady_clock::now();
+    auto stageStart = initializationStart;
+    initializationTimes = {};
+
     state = NEO::getDevices(numDevicesReturned, *executionEnvironment) ? StateIniting : StateNone;
+    initializationTimes.getDevices = elapsedMicroseconds(stageStart);
 
     if (state == StateNone) {
         return false;
@@ -148,17 +224,26 @@ bool Platform::initialize() {
     }
 
     executionEnvironment->initializeMemoryManager();
+    initializationTimes.memoryManager = elapsedMicroseconds(stageStart);
 
     DEBUG_BREAK_IF(this->platformInfo);
     this->platformInfo.reset(new PlatformInfo);
 
-    this->devices.resize(numDevicesReturned);
+    executionEnvironment->initGmm();
+    initializationTimes.gmm = elapsedMicroseconds(stageStart);
+
+    createRootDevices(numDevicesReturned);
+    initializationTimes.devices = elapsedMicroseconds(stageStart);
+    for (auto device : this->devices) {
+        if (device) {
+            initializationTimes.engines = std::max(initializationTimes.engines, device->peekEnginesInitializationTime());
+        }
+    }
+
     for (uint32_t deviceOrdinal = 0; deviceOrdinal < numDevicesReturned; ++deviceOrdinal) {
-        auto pDevice = createRootDevice(deviceOrdinal);
+        auto pDevice = this->devices[deviceOrdinal];
         DEBUG_BREAK_IF(!pDevice);
         if (pDevice) {
-            this->devices[deviceOrdinal] = pDevice;
-
             this->platformInfo->extensions = pDevice->getDeviceInfo().deviceExtensions;
 
             switch (pDevice->getEnabledClVersion()) {
@@ -182,10 +267,13 @@ bool Platform::initialize() {
     auto hwInfo = executionEnvironment->getHardwareInfo();
 
     const bool sourceLevelDebuggerActive = executionEnvironment->sourceLevelDebugger && executionEnvironment->sourceLevelDebugger->isDebuggerActive();
-    if (devices[0]->getPreemptionMode() == PreemptionMode::MidThread || sourceLevelDebuggerActive) {
+    // in lazy mode SIP kernel is built on first use by the command stream receiver
+    const bool lazySipKernel = DebugManager.flags.LazyEngineInitialization.get() && !sourceLevelDebuggerActive;
+    if ((devices[0]->getPreemptionMode() == PreemptionMode::MidThread || sourceLevelDebuggerActive) && !lazySipKernel) {
         auto sipType = SipKernel::getSipKernelType(hwInfo->platform.eRenderCoreFamily, devices[0]->isSourceLevelDebuggerActive());
         initSipKernel(sipType, *devices[0]);
     }
+    initializationTimes.sipKernel = elapsedMicroseconds(stageStart);
 
     CommandStreamReceiverType csrType = this->devices[0]->getDefaultEngine().commandStreamReceiver->getType();
     if (csrType != CommandStreamReceiverType::CSR_HW) {
@@ -195,6 +283,8 @@ bool Platform::initialize() {
 
     this->fillGlobalDispatchTable();
     DEBUG_BREAK_IF(DebugManager.flags.CreateMultipleRootDevices.get() > 1 && !this->devices[0]->getDefaultEngine().commandStreamReceiver->peekTimestampPacketWriteEnabled());
+    initializationTimes.total = elapsedMicroseconds(initializationStart);
+    reportInitializationTimes();
     state = StateInited;
     return true;
 }
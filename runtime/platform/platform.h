@@ -26,6 +26,17 @@ class GmmHelper;
 class GmmClientContext;
 struct HardwareInfo;
 
+struct PlatformInitializationTimes {
+    // all values in microseconds
+    uint64_t getDevices = 0;
+    uint64_t memoryManager = 0;
+    uint64_t gmm = 0;
+    uint64_t devices = 0;
+    uint64_t engines = 0; // slowest root device, already included in devices
+    uint64_t sipKernel = 0;
+    uint64_t total = 0;
+};
+
 template <>
 struct OpenCLObjectMapper<_cl_platform_id> {
     typedef class Platform DerivedType;
@@ -61,6 +72,7 @@ class Platform : public BaseObject<_cl_platform_id> {
     ExecutionEnvironment *peekExecutionEnvironment() const { return executionEnvironment; }
     GmmHelper *peekGmmHelper() const;
     GmmClientContext *peekGmmClientContext() const;
+    const PlatformInitializationTimes &peekInitializationTimes() const { return initializationTimes; }
 
   protected:
     enum {
@@ -72,11 +84,14 @@ class Platform : public BaseObject<_cl_platform_id> {
     void fillGlobalDispatchTable();
     MOCKABLE_VIRTUAL void initializationLoopHelper(){};
     MOCKABLE_VIRTUAL RootDevice *createRootDevice(uint32_t rootDeviceIndex) const;
+    void createRootDevices(size_t numRootDevices);
+    void reportInitializationTimes() const;
     std::unique_ptr<PlatformInfo> platformInfo;
     DeviceVector devices;
     std::string compilerExtensions;
     std::unique_ptr<AsyncEventsHandler> asyncEventsHandler;
     ExecutionEnvironment *executionEnvironment = nullptr;
+    PlatformInitializationTimes initializationTimes;
 };
 
 extern std::unique_ptr<Platform> platformImpl;
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/enqueue_phase_profiler.h"
+
+namespace NEO {
+
+thread_local EnqueuePhaseProfiler *gEnqueuePhaseProfiler = nullptr;
+
+const char *EnqueuePhaseProfiler::getPhaseName(EnqueuePhase phase) {
+    switch (phase) {
+    case EnqueuePhase::ObtainTaskLevelAndBlockedStatus:
+        return "obtainTaskLevelAndBlockedStatus";
+    case EnqueuePhase::ProcessDispatchForKernels:
+        return "processDispatchForKernels";
+    case EnqueuePhase::FlushTask:
+        return "flushTask";
+    case EnqueuePhase::Flush:
+        return "flush";
+    default:
+        return "unknown";
+    }
+}
+} // namespace NEO
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace NEO {
+class EnqueuePhaseScope;
+
+enum class EnqueuePhase : uint32_t {
+    ObtainTaskLevelAndBlockedStatus = 0,
+    ProcessDispatchForKernels,
+    FlushTask,
+    Flush,
+    Count
+};
+
+class EnqueuePhaseProfiler {
+  public:
+    static const char *getPhaseName(EnqueuePhase phase);
+
+    void record(EnqueuePhase phase, std::chrono::nanoseconds time) {
+        auto index = static_cast<uint32_t>(phase);
+        totalTimes[index] += static_cast<uint64_t>(time.count());
+        callsCounts[index]++;
+    }
+
+    uint64_t getTotalTimeNs(EnqueuePhase phase) const { return totalTimes[static_cast<uint32_t>(phase)]; }
+    uint64_t getCallsCount(EnqueuePhase phase) const { return callsCounts[static_cast<uint32_t>(phase)]; }
+
+    void reset() {
+        totalTimes.fill(0);
+        callsCounts.fill(0);
+    }
+
+  protected:
+    friend class EnqueuePhaseScope;
+
+    EnqueuePhaseScope *currentScope = nullptr;
+    std::array<uint64_t, static_cast<size_t>(EnqueuePhase::Count)> totalTimes = {};
+    std::array<uint64_t, static_cast<size_t>(EnqueuePhase::Count)> callsCounts = {};
+};
+
+// Profiler collecting enqueue phase times on the current thread, installed by benchmarks and tests
+extern thread_local EnqueuePhaseProfiler *gEnqueuePhaseProfiler;
+
+// Records exclusive time of a phase, time spent in nested phases (e.g. flush inside flushTask)
+// is subtracted from the enclosing one so phase times add up to the measured call time
+class EnqueuePhaseScope {
+  public:
+    EnqueuePhaseScope(EnqueuePhase phase) : profiler(gEnqueuePhaseProfiler), phase(phase) {
+        if (profiler) {
+            parent = profiler->currentScope;
+            profiler->currentScope = this;
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~EnqueuePhaseScope() {
+        if (profiler) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            profiler->record(phase, elapsed - nestedTime);
+            if (parent) {
+                parent->nestedTime += elapsed;
+            }
+            profiler->currentScope = parent;
+        }
+    }
+
+    EnqueuePhaseScope(const EnqueuePhaseScope &) = delete;
+    EnqueuePhaseScope &operator=(const EnqueuePhaseScope &) = delete;
+
+  protected:
+    EnqueuePhaseProfiler *profiler;
+    EnqueuePhaseScope *parent = nullptr;
+    EnqueuePhase phase;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::nanoseconds nestedTime{0};
+};
+} // namespace NEO
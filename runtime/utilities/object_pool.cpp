@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/object_pool.h"
+
+#include "core/debug_settings/debug_settings_manager.h"
+
+#include <new>
+
+namespace NEO {
+
+namespace {
+struct alignas(std::max_align_t) PoolableObjectHeader {
+    ObjectPool *objectPool;
+    size_t size;
+};
+} // namespace
+
+void *ObjectPool::allocate(size_t size) {
+    if (size > maxSlotSize) {
+        return nullptr;
+    }
+    auto sizeClass = getSizeClass(size);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (freeSlots[sizeClass] == nullptr) {
+        auto slotSize = (sizeClass + 1) * slotGranularity;
+        slabs.emplace_back(std::make_unique<uint8_t[]>(slotSize * slotsPerSlab));
+        auto slab = slabs.back().get();
+        for (size_t i = slotsPerSlab; i > 0; i--) {
+            auto slot = reinterpret_cast<FreeSlot *>(slab + (i - 1) * slotSize);
+            slot->next = freeSlots[sizeClass];
+            freeSlots[sizeClass] = slot;
+        }
+    }
+    auto slot = freeSlots[sizeClass];
+    freeSlots[sizeClass] = slot->next;
+    incRefInternal();
+    return slot;
+}
+
+void ObjectPool::deallocate(void *ptr, size_t size) {
+    auto sizeClass = getSizeClass(size);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto slot = static_cast<FreeSlot *>(ptr);
+        slot->next = freeSlots[sizeClass];
+        freeSlots[sizeClass] = slot;
+    }
+    // may release the pool, nothing can be touched afterwards
+    decRefInternal();
+}
+
+size_t ObjectPool::getSlabsCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return slabs.size();
+}
+
+void *PoolableObject::allocate(size_t size, ObjectPool *objectPool) {
+    auto allocationSize = size + sizeof(PoolableObjectHeader);
+    void *memory = nullptr;
+    if (objectPool && DebugManager.flags.EnableObjectPooling.get()) {
+        memory = objectPool->allocate(allocationSize);
+    }
+    if (memory == nullptr) {
+        objectPool = nullptr;
+        memory = ::operator new(allocationSize);
+    }
+    auto header = static_cast<PoolableObjectHeader *>(memory);
+    header->objectPool = objectPool;
+    header->size = allocationSize;
+    return header + 1;
+}
+
+void PoolableObject::deallocate(void *ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    auto header = static_cast<PoolableObjectHeader *>(ptr) - 1;
+    if (header->objectPool) {
+        header->objectPool->deallocate(header, header->size);
+    } else {
+        ::operator delete(header);
+    }
+}
+} // namespace NEO
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "core/utilities/reference_tracked_object.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Slab allocator for small objects created on every enqueue (events, flush stamps, blocked commands).
+// Slots are carved out of slabs and returned to per size class free lists on delete, so once the
+// pool is warmed up these objects are created without reaching the global heap.
+// Every slot in use holds a reference, so the pool stays alive until the last object is released
+// even if its owner (context) is destroyed earlier.
+class ObjectPool : public ReferenceTrackedObject<ObjectPool> {
+  public:
+    static constexpr size_t slotGranularity = 64;
+    static constexpr size_t maxSlotSize = 2048;
+    static constexpr size_t slotsPerSlab = 16;
+
+    // returns nullptr when size exceeds maxSlotSize
+    void *allocate(size_t size);
+    void deallocate(void *ptr, size_t size);
+
+    size_t getSlabsCount() const;
+
+  protected:
+    struct FreeSlot {
+        FreeSlot *next;
+    };
+
+    static size_t getSizeClass(size_t size) { return (size - 1) / slotGranularity; }
+
+    mutable std::mutex mutex;
+    std::array<FreeSlot *, maxSlotSize / slotGranularity> freeSlots = {};
+    std::vector<std::unique_ptr<uint8_t[]>> slabs;
+};
+
+// Base for objects which can be placed in an ObjectPool with new (objectPool) T(...).
+// Objects created with plain new or with a null pool come from the global heap,
+// delete returns each of them to where it was allocated from.
+class PoolableObject {
+  public:
+    static void *operator new(size_t size) { return allocate(size, nullptr); }
+    static void *operator new(size_t size, ObjectPool *objectPool) { return allocate(size, objectPool); }
+    static void operator delete(void *ptr) { deallocate(ptr); }
+    static void operator delete(void *ptr, ObjectPool *objectPool) { deallocate(ptr); }
+
+  protected:
+    static void *allocate(size_t size, ObjectPool *objectPool);
+    static void deallocate(void *ptr);
+};
+} // namespace NEO
@@ -11,9 +11,12 @@
 #include "core/utilities/idlist.h"
 #include "runtime/memory_manager/memory_manager.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace NEO {
@@ -88,14 +91,22 @@ class TagAllocator {
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
+        NodeType *node = takeFromThreadCache();
+        if (node == nullptr) {
+            if (freeTags.peekIsEmpty()) {
+                releaseDeferredTags();
+            }
+            node = freeTags.removeFrontOne().release();
         }
-        NodeType *node = freeTags.removeFrontOne().release();
-        if (!node) {
+        while (!node) {
+            // other threads may drain the new pool before we take from it
             std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
+            flushThreadCaches();
             node = freeTags.removeFrontOne().release();
+            if (!node) {
+                populateFreeTags();
+                node = freeTags.removeFrontOne().release();
+            }
         }
         usedTags.pushFrontOne(*node);
         node->incRefCount();
@@ -114,6 +125,14 @@ class TagAllocator {
     }
 
   protected:
+    // Released tags are first kept in a small cache picked by the calling thread, so threads taking and
+    // returning tags concurrently mostly lock their own cache instead of the shared free list
+    struct ThreadCache {
+        std::mutex mutex;
+        std::vector<NodeType *> nodes;
+    };
+    static constexpr size_t threadCacheCount = 16;
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
@@ -126,20 +145,60 @@ class TagAllocator {
     size_t tagAlignment;
     size_t tagSize;
     bool doNotReleaseNodes = false;
+    size_t threadCacheCapacity = 32;
 
+    std::array<ThreadCache, threadCacheCount> threadCaches;
     std::mutex allocatorMutex;
+    std::mutex deferredTagsMutex;
+
+    ThreadCache &getThreadCache() {
+        return threadCaches[std::hash<std::thread::id>()(std::this_thread::get_id()) % threadCacheCount];
+    }
+
+    NodeType *takeFromThreadCache() {
+        auto &threadCache = getThreadCache();
+        std::lock_guard<std::mutex> lock(threadCache.mutex);
+        if (threadCache.nodes.empty()) {
+            return nullptr;
+        }
+        auto node = threadCache.nodes.back();
+        threadCache.nodes.pop_back();
+        return node;
+    }
+
+    bool putToThreadCache(NodeType *node) {
+        auto &threadCache = getThreadCache();
+        std::lock_guard<std::mutex> lock(threadCache.mutex);
+        if (threadCache.nodes.size() >= threadCacheCapacity) {
+            return false;
+        }
+        threadCache.nodes.push_back(node);
+        return true;
+    }
+
+    void flushThreadCaches() {
+        for (auto &threadCache : threadCaches) {
+            std::lock_guard<std::mutex> lock(threadCache.mutex);
+            for (auto node : threadCache.nodes) {
+                freeTags.pushFrontOne(*node);
+            }
+            threadCache.nodes.clear();
+        }
+    }
 
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
         NodeType *usedNode = usedTags.removeOne(*node).release();
         DEBUG_BREAK_IF(usedNode == nullptr);
         UNUSED_VARIABLE(usedNode);
-        freeTags.pushFrontOne(*node);
+        if (!putToThreadCache(node)) {
+            freeTags.pushFrontOne(*node);
+        }
     }
 
     void returnTagToDeferredPool(NodeType *node) {
         NodeType *usedNode = usedTags.removeOne(*node).release();
         DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        deferredTags.pushTailOne(*usedNode);
     }
 
     void populateFreeTags() {
@@ -171,16 +230,37 @@ class TagAllocator {
     }
 
     void releaseDeferredTags() {
+        // tags deferred while the list is detached are appended to it, so anything put back goes to the front
+        std::unique_lock<std::mutex> lock(deferredTagsMutex);
+        auto currentNode = deferredTags.detachNodes();
+        if (currentNode == nullptr) {
+            return;
+        }
+
+        // Deferred tags are kept in return order, which follows completion order on a single engine.
+        // Release the completed prefix first and scan the whole list only if the oldest tag is still busy.
+        NodeType *lastCompletedNode = nullptr;
+        for (auto node = currentNode; node != nullptr && node->canBeReleased(); node = node->next) {
+            lastCompletedNode = node;
+        }
+        if (lastCompletedNode != nullptr) {
+            auto remainingNodes = lastCompletedNode->slice();
+            freeTags.splice(*currentNode);
+            if (remainingNodes != nullptr) {
+                deferredTags.spliceFront(*remainingNodes);
+            }
+            return;
+        }
+
         IDList<NodeType, false> pendingFreeTags;
         IDList<NodeType, false> pendingDeferredTags;
-        auto currentNode = deferredTags.detachNodes();
 
         while (currentNode != nullptr) {
             auto nextNode = currentNode->next;
             if (currentNode->canBeReleased()) {
                 pendingFreeTags.pushFrontOne(*currentNode);
             } else {
-                pendingDeferredTags.pushFrontOne(*currentNode);
+                pendingDeferredTags.pushTailOne(*currentNode);
             }
             currentNode = nextNode;
         }
@@ -189,7 +269,7 @@ class TagAllocator {
             freeTags.splice(*pendingFreeTags.detachNodes());
         }
         if (!pendingDeferredTags.peekIsEmpty()) {
-            deferredTags.splice(*pendingDeferredTags.detachNodes());
+            deferredTags.spliceFront(*pendingDeferredTags.detachNodes());
         }
     }
 };
@@ -172,4 +172,44 @@ TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueNDRangeKernelINTELWhenG
     auto retVal = clGetExtensionFunctionAddress("clEnqueueNDRangeKernelINTEL");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueNDRangeKernelINTEL));
 }
+TEST_F(clGetExtensionFunctionAddressTests, GivenClCreateCommandListINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clCreateCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCreateCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClRetainCommandListINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clRetainCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clRetainCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClReleaseCommandListINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clReleaseCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clReleaseCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClCommandListNDRangeKernelINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clCommandListNDRangeKernelINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCommandListNDRangeKernelINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClCommandListCopyBufferINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clCommandListCopyBufferINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clCommandListCopyBufferINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClFinalizeCommandListINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clFinalizeCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clFinalizeCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueCommandListINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clEnqueueCommandListINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueCommandListINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClReleaseHostPtrAllocationsINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clReleaseHostPtrAllocationsINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clReleaseHostPtrAllocationsINTEL));
+}
+
 } // namespace ULT
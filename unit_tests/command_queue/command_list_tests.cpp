@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_queue/command_list.h"
+#include "runtime/event/event.h"
+#include "test.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/helpers/hw_parse.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+using namespace NEO;
+
+using CommandListTest = Test<DeviceFixture>;
+
+HWTEST_F(CommandListTest, givenKernelAppendedToCommandListWhenFinalizedThenWalkerAndBatchBufferEndAreRecordedInContainer) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    using MI_BATCH_BUFFER_END = typename FamilyType::MI_BATCH_BUFFER_END;
+
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, commandList);
+
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+    EXPECT_TRUE(commandList->isFinalized());
+    ASSERT_EQ(1u, commandList->getRecordedDispatches().size());
+    EXPECT_EQ(mockKernel.mockKernel, commandList->getRecordedDispatches()[0].kernel);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(*commandList->getCommandContainer().getCommandStream());
+    EXPECT_NE(hwParser.cmdList.end(), find<WALKER_TYPE *>(hwParser.cmdList.begin(), hwParser.cmdList.end()));
+    EXPECT_NE(hwParser.cmdList.end(), find<MI_BATCH_BUFFER_END *>(hwParser.cmdList.begin(), hwParser.cmdList.end()));
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenFinalizedCommandListWhenAppendingOrFinalizingAgainThenInvalidOperationIsReturned) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+
+    EXPECT_EQ(CL_INVALID_OPERATION, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_INVALID_OPERATION, commandList->finalize());
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenKernelWithPrintfOrUnsetArgumentsWhenAppendingThenItIsRejected) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+
+    MockKernelWithInternals printfKernel(*pDevice, &context);
+    SPatchAllocateStatelessPrintfSurface printfSurface = {};
+    printfKernel.kernelInfo.patchInfo.pAllocateStatelessPrintfSurface = &printfSurface;
+    EXPECT_EQ(CL_INVALID_OPERATION, commandList->appendKernel(*printfKernel.mockKernel, 1, nullptr, gws, nullptr));
+
+    MockKernelWithInternals unpatchedKernel(*pDevice, &context);
+    unpatchedKernel.mockKernel->isPatchedOverride = false;
+    EXPECT_EQ(CL_INVALID_KERNEL_ARGS, commandList->appendKernel(*unpatchedKernel.mockKernel, 1, nullptr, gws, nullptr));
+
+    EXPECT_TRUE(commandList->getRecordedDispatches().empty());
+    EXPECT_EQ(0u, commandList->getCommandContainer().getCommandStream()->getUsed());
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenCommandListNotFinalizedWhenEnqueuedThenInvalidOperationIsReturned) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, cmdQ.enqueueCommandList(*commandList, 0, nullptr, nullptr));
+    EXPECT_EQ(0u, cmdQ.taskCount);
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenFinalizedCommandListWhenEnqueuedTwiceThenEachSubmissionIsATaskAndContainerIsNotReencoded) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+    auto containerStreamUsed = commandList->getCommandContainer().getCommandStream()->getUsed();
+
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 0, nullptr, &event));
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_COMMAND_LIST_INTEL), castToObject<Event>(event)->getCommandType());
+    EXPECT_EQ(1u, cmdQ.taskCount);
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 0, nullptr, nullptr));
+    EXPECT_EQ(2u, cmdQ.taskCount);
+    EXPECT_EQ(containerStreamUsed, commandList->getCommandContainer().getCommandStream()->getUsed());
+    EXPECT_EQ(0u, commandList->getPatchCount());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdQ.getCS(0));
+    auto itorBbStart = find<MI_BATCH_BUFFER_START *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), itorBbStart);
+    auto bbStart = genCmdCast<MI_BATCH_BUFFER_START *>(*itorBbStart);
+    EXPECT_EQ(commandList->getCommandContainer().getCmdBufferAllocation()->getGpuAddress(), bbStart->getBatchBufferStartAddressGraphicsaddress472());
+
+    clReleaseEvent(event);
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenKernelArgumentChangedAfterRecordingWhenCommandListIsEnqueuedThenRecordedCrossThreadDataIsPatched) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context, true);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 0, nullptr, nullptr));
+    EXPECT_EQ(0u, commandList->getPatchCount());
+
+    uint64_t newArgValue = 0x12345678u;
+    memcpy_s(mockKernel.mockKernel->getCrossThreadData(), sizeof(newArgValue), &newArgValue, sizeof(newArgValue));
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, commandList->getPatchCount());
+
+    auto ioh = commandList->getCommandContainer().getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+    auto recordedCrossThreadData = ptrOffset(ioh->getCpuBase(), commandList->getRecordedDispatches()[0].crossThreadDataOffset);
+    EXPECT_EQ(0, memcmp(recordedCrossThreadData, &newArgValue, sizeof(newArgValue)));
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenKernelAppendedTwiceWhenArgumentChangedBetweenAppendsThenSecondAppendIsRejected) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context, true);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(2u, commandList->getRecordedDispatches().size());
+
+    uint64_t newArgValue = 0x12345678u;
+    memcpy_s(mockKernel.mockKernel->getCrossThreadData(), sizeof(newArgValue), &newArgValue, sizeof(newArgValue));
+
+    EXPECT_EQ(CL_INVALID_OPERATION, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(2u, commandList->getRecordedDispatches().size());
+
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 0, nullptr, nullptr));
+    EXPECT_EQ(2u, commandList->getPatchCount());
+
+    auto ioh = commandList->getCommandContainer().getIndirectHeap(IndirectHeap::INDIRECT_OBJECT);
+    for (auto &recordedDispatch : commandList->getRecordedDispatches()) {
+        auto recordedCrossThreadData = ptrOffset(ioh->getCpuBase(), recordedDispatch.crossThreadDataOffset);
+        EXPECT_EQ(0, memcmp(recordedCrossThreadData, &newArgValue, sizeof(newArgValue)));
+    }
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenKernelWithSshForBuffersWhenAppendIsRejectedForChangedArgumentsThenKernelSshIsNotMarkedDirty) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context, true);
+    mockKernel.kernelInfo.usesSsh = true;
+    mockKernel.kernelInfo.requiresSshForBuffers = true;
+    mockKernel.mockKernel->kernelArguments[0].type = Kernel::BUFFER_OBJ;
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+
+    auto &dispatchTemplate = mockKernel.mockKernel->getDispatchTemplate();
+    dispatchTemplate.recordSurfaceStateHeap(1u, 0u);
+
+    uint64_t newArgValue = 0x12345678u;
+    memcpy_s(mockKernel.mockKernel->getCrossThreadData(), sizeof(newArgValue), &newArgValue, sizeof(newArgValue));
+    EXPECT_EQ(CL_INVALID_OPERATION, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+
+    size_t bindingTablePointer = 0;
+    EXPECT_TRUE(dispatchTemplate.reuseSurfaceStateHeap(1u, bindingTablePointer));
+
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenTimestampPacketWriteEnabledWhenCommandListIsEnqueuedWithEventThenEventGetsTimestampPacketWrittenAfterReplay) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+
+    pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 0, nullptr, &event));
+    ASSERT_NE(nullptr, event);
+
+    auto eventNodes = castToObject<Event>(event)->getTimestampPacketNodes();
+    ASSERT_NE(nullptr, eventNodes);
+    ASSERT_EQ(1u, eventNodes->peekNodes().size());
+    auto timestampPacketNode = cmdQ.timestampPacketContainer->peekNodes()[0];
+    EXPECT_EQ(timestampPacketNode, eventNodes->peekNodes()[0]);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdQ.getCS(0));
+    auto itorBbStart = find<MI_BATCH_BUFFER_START *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), itorBbStart);
+
+    uint64_t expectedAddress = timestampPacketNode->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd);
+    bool postSyncFound = false;
+    for (auto itor = itorBbStart; itor != hwParser.cmdList.end(); itor++) {
+        auto pipeControl = genCmdCast<PIPE_CONTROL *>(*itor);
+        if (pipeControl && pipeControl->getPostSyncOperation() == PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA) {
+            uint64_t address = (static_cast<uint64_t>(pipeControl->getAddressHigh()) << 32) | pipeControl->getAddress();
+            postSyncFound |= (expectedAddress == address);
+        }
+    }
+    EXPECT_TRUE(postSyncFound);
+
+    clReleaseEvent(event);
+    commandList->release();
+}
+
+HWTEST_F(CommandListTest, givenTimestampPacketWriteEnabledAndEventFromSameCsrWhenCommandListIsEnqueuedThenSemaphoreIsProgrammedBeforeReplay) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockCommandQueueHw<FamilyType> otherCmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+    cl_int retVal = CL_SUCCESS;
+
+    auto commandList = CommandList::create(&cmdQ, retVal);
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_EQ(CL_SUCCESS, commandList->appendKernel(*mockKernel.mockKernel, 1, nullptr, gws, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandList->finalize());
+
+    cl_event waitEvent = nullptr;
+    EXPECT_EQ(CL_SUCCESS, otherCmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &waitEvent));
+    auto waitNode = castToObject<Event>(waitEvent)->getTimestampPacketNodes()->peekNodes()[0];
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueCommandList(*commandList, 1, &waitEvent, nullptr));
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdQ.getCS(0));
+    auto itorBbStart = find<MI_BATCH_BUFFER_START *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), itorBbStart);
+
+    uint64_t expectedAddress = waitNode->getGpuAddress() + offsetof(TimestampPacketStorage, packets[0].contextEnd);
+    bool semaphoreFound = false;
+    for (auto itor = hwParser.cmdList.begin(); itor != itorBbStart; itor++) {
+        auto semaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(*itor);
+        if (semaphore) {
+            semaphoreFound |= (expectedAddress == semaphore->getSemaphoreGraphicsAddress());
+        }
+    }
+    EXPECT_TRUE(semaphoreFound);
+
+    clReleaseEvent(waitEvent);
+    commandList->release();
+}
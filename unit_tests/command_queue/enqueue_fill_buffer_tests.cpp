@@ -7,6 +7,7 @@
 
 #include "core/helpers/aligned_memory.h"
 #include "core/helpers/ptr_math.h"
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "runtime/built_ins/built_ins.h"
 #include "runtime/built_ins/builtins_dispatch_builder.h"
 #include "runtime/command_queue/command_queue.h"
@@ -21,6 +22,8 @@
 #include "unit_tests/gen_common/gen_commands_common_validation.h"
 #include "unit_tests/helpers/unit_test_helper.h"
 #include "unit_tests/mocks/mock_buffer.h"
+#include "unit_tests/mocks/mock_builtin_dispatch_info_builder.h"
+#include "unit_tests/mocks/mock_builtins.h"
 
 #include "reg_configs_common.h"
 
@@ -28,6 +31,57 @@ using namespace NEO;
 
 typedef Test<EnqueueFillBufferFixture> EnqueueFillBufferCmdTests;
 
+namespace {
+// pattern too large to be passed by value, so it is placed in a pattern allocation
+struct EnqueueFillBufferLargePatternTraits : public EnqueueFillBufferTraits {
+    static const float pattern[2 * maxImmediateFillPatternSize / sizeof(float)];
+    static const size_t patternSize;
+    static const size_t size;
+};
+
+const float EnqueueFillBufferLargePatternTraits::pattern[2 * maxImmediateFillPatternSize / sizeof(float)] = {1.2345f};
+const size_t EnqueueFillBufferLargePatternTraits::patternSize = sizeof(pattern);
+const size_t EnqueueFillBufferLargePatternTraits::size = 2 * patternSize;
+
+struct MockFillBufferBuilder : MockBuiltinDispatchInfoBuilder {
+    using MockBuiltinDispatchInfoBuilder::MockBuiltinDispatchInfoBuilder;
+
+    void validateInput(const BuiltinOpParams &conf) const override {
+        if (conf.srcMemObj == nullptr) {
+            auto pattern = static_cast<const uint8_t *>(conf.srcPtr);
+            immediatePattern.assign(pattern, pattern + conf.patternSize);
+        }
+    }
+
+    mutable std::vector<uint8_t> immediatePattern;
+};
+
+struct MockFillBufferBuilderWithoutImmediateKernels : MockBuiltinDispatchInfoBuilder {
+    using MockBuiltinDispatchInfoBuilder::MockBuiltinDispatchInfoBuilder;
+
+    bool buildDispatchInfos(MultiDispatchInfo &mdi, const BuiltinOpParams &conf) const override {
+        if (conf.srcMemObj == nullptr) {
+            return false;
+        }
+        return MockBuiltinDispatchInfoBuilder::buildDispatchInfos(mdi, conf);
+    }
+};
+
+std::vector<uint8_t> getImmediatePatternOfFill(CommandQueue &cmdQ, Buffer *dstBuffer, const void *pattern, size_t patternSize, size_t size) {
+    auto builtIns = new MockBuiltins();
+    cmdQ.getDevice().getExecutionEnvironment()->builtins.reset(builtIns);
+    auto &origBuilder = builtIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, cmdQ.getContext(), cmdQ.getDevice());
+    auto oldBuilder = builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, cmdQ.getContext(), cmdQ.getDevice(),
+                                                              std::unique_ptr<BuiltinDispatchInfoBuilder>(new MockFillBufferBuilder(*builtIns, &origBuilder)));
+
+    auto retVal = clEnqueueFillBuffer(&cmdQ, dstBuffer, pattern, patternSize, 0, size, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto mockBuilder = builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, cmdQ.getContext(), cmdQ.getDevice(), std::move(oldBuilder));
+    return static_cast<MockFillBufferBuilder *>(mockBuilder.get())->immediatePattern;
+}
+} // namespace
+
 HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenTaskCountIsAlignedWithCsr) {
     //this test case assumes IOQ
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
@@ -400,15 +454,17 @@ HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferStatelessThenStatelessKerne
 
 HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternShouldBeCopied) {
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
-    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
-    EnqueueFillBufferHelper<>::enqueueFillBuffer(pCmdQ, buffer);
-    ASSERT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
-    GraphicsAllocation *allocation = csr.getTemporaryAllocations().peekHead();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> dstBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, EnqueueFillBufferLargePatternTraits::size, nullptr, retVal));
+    EnqueueFillBufferHelper<EnqueueFillBufferLargePatternTraits>::enqueueFillBuffer(pCmdQ, dstBuffer.get());
+    ASSERT_FALSE(csr.getAllocationsForReuse().peekIsEmpty());
+    GraphicsAllocation *allocation = csr.getAllocationsForReuse().peekHead();
 
     while (allocation != nullptr) {
         if ((allocation->getUnderlyingBufferSize() >= sizeof(float)) &&
             (allocation->getUnderlyingBuffer() != nullptr) &&
-            (*(static_cast<float *>(allocation->getUnderlyingBuffer())) == EnqueueFillBufferHelper<>::Traits::pattern[0]) &&
+            (*(static_cast<float *>(allocation->getUnderlyingBuffer())) == EnqueueFillBufferLargePatternTraits::pattern[0]) &&
             (pCmdQ->taskCount == allocation->getTaskCount(csr.getOsContext().getContextId()))) {
             break;
         }
@@ -416,20 +472,22 @@ HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternShouldBeCopied)
     }
 
     ASSERT_NE(nullptr, allocation);
-    EXPECT_NE(&EnqueueFillBufferHelper<>::Traits::pattern[0], allocation->getUnderlyingBuffer());
+    EXPECT_NE(&EnqueueFillBufferLargePatternTraits::pattern[0], allocation->getUnderlyingBuffer());
 }
 
 HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternShouldBeAligned) {
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
-    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
-    EnqueueFillBufferHelper<>::enqueueFillBuffer(pCmdQ, buffer);
-    ASSERT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
-    GraphicsAllocation *allocation = csr.getTemporaryAllocations().peekHead();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> dstBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, EnqueueFillBufferLargePatternTraits::size, nullptr, retVal));
+    EnqueueFillBufferHelper<EnqueueFillBufferLargePatternTraits>::enqueueFillBuffer(pCmdQ, dstBuffer.get());
+    ASSERT_FALSE(csr.getAllocationsForReuse().peekIsEmpty());
+    GraphicsAllocation *allocation = csr.getAllocationsForReuse().peekHead();
 
     while (allocation != nullptr) {
         if ((allocation->getUnderlyingBufferSize() >= sizeof(float)) &&
             (allocation->getUnderlyingBuffer() != nullptr) &&
-            (*(static_cast<float *>(allocation->getUnderlyingBuffer())) == EnqueueFillBufferHelper<>::Traits::pattern[0]) &&
+            (*(static_cast<float *>(allocation->getUnderlyingBuffer())) == EnqueueFillBufferLargePatternTraits::pattern[0]) &&
             (pCmdQ->taskCount == allocation->getTaskCount(csr.getOsContext().getContextId()))) {
             break;
         }
@@ -443,81 +501,70 @@ HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternShouldBeAligned)
 
 HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternOfSizeOneByteShouldGetPreparedForMiddleKernel) {
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
-    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
-    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
-
     auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
     const uint8_t pattern[1] = {0x55};
     const size_t patternSize = sizeof(pattern);
-    const size_t offset = 0;
     const size_t size = 4 * patternSize;
     const uint8_t output[4] = {0x55, 0x55, 0x55, 0x55};
 
-    auto retVal = clEnqueueFillBuffer(
-        pCmdQ,
-        dstBuffer.get(),
-        pattern,
-        patternSize,
-        offset,
-        size,
-        0,
-        nullptr,
-        nullptr);
-    ASSERT_EQ(CL_SUCCESS, retVal);
-
-    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
-    ASSERT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
+    auto immediatePattern = getImmediatePatternOfFill(*pCmdQ, dstBuffer.get(), pattern, patternSize, size);
 
-    GraphicsAllocation *allocation = csr.getTemporaryAllocations().peekHead();
-    ASSERT_NE(nullptr, allocation);
-
-    EXPECT_EQ(0, memcmp(allocation->getUnderlyingBuffer(), output, size));
+    EXPECT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+    ASSERT_EQ(sizeof(output), immediatePattern.size());
+    EXPECT_EQ(0, memcmp(immediatePattern.data(), output, sizeof(output)));
 }
 
 HWTEST_F(EnqueueFillBufferCmdTests, WhenFillingBufferThenPatternOfSizeTwoBytesShouldGetPreparedForMiddleKernel) {
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
-    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
-    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
-
     auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
     const uint8_t pattern[2] = {0x55, 0xAA};
     const size_t patternSize = sizeof(pattern);
-    const size_t offset = 0;
     const size_t size = 2 * patternSize;
     const uint8_t output[4] = {0x55, 0xAA, 0x55, 0xAA};
 
-    auto retVal = clEnqueueFillBuffer(
-        pCmdQ,
-        dstBuffer.get(),
-        pattern,
-        patternSize,
-        offset,
-        size,
-        0,
-        nullptr,
-        nullptr);
-    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto immediatePattern = getImmediatePatternOfFill(*pCmdQ, dstBuffer.get(), pattern, patternSize, size);
 
+    EXPECT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+    ASSERT_EQ(sizeof(output), immediatePattern.size());
+    EXPECT_EQ(0, memcmp(immediatePattern.data(), output, sizeof(output)));
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenImmediateFillPatternDisabledWhenFillingBufferThenPatternOfSizeOneByteIsPreparedInPatternAllocation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableImmediateFillPattern.set(false);
+
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
     ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
-    ASSERT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
 
-    GraphicsAllocation *allocation = csr.getTemporaryAllocations().peekHead();
-    ASSERT_NE(nullptr, allocation);
+    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
+    const uint8_t pattern[1] = {0x55};
+    const size_t patternSize = sizeof(pattern);
+    const size_t size = 4 * patternSize;
+    const uint8_t output[4] = {0x55, 0x55, 0x55, 0x55};
 
+    auto retVal = clEnqueueFillBuffer(pCmdQ, dstBuffer.get(), pattern, patternSize, 0, size, 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    GraphicsAllocation *allocation = csr.getAllocationsForReuse().peekHead();
+    ASSERT_NE(nullptr, allocation);
     EXPECT_EQ(0, memcmp(allocation->getUnderlyingBuffer(), output, size));
 }
 
 HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferWhenPatternAllocationIsObtainedThenItsTypeShouldBeSetToFillPattern) {
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
-    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
 
-    auto dstBuffer = std::unique_ptr<Buffer>(BufferHelper<>::create());
-    const uint8_t pattern[1] = {0x55};
+    // patterns up to maxImmediateFillPatternSize are passed by value
+    const uint8_t pattern[2 * maxImmediateFillPatternSize] = {0x55};
     const size_t patternSize = sizeof(pattern);
     const size_t offset = 0;
     const size_t size = patternSize;
+    cl_int retVal = CL_SUCCESS;
+    auto dstBuffer = std::unique_ptr<Buffer>(Buffer::create(&context, CL_MEM_READ_WRITE, size, nullptr, retVal));
 
-    auto retVal = clEnqueueFillBuffer(
+    retVal = clEnqueueFillBuffer(
         pCmdQ,
         dstBuffer.get(),
         pattern,
@@ -529,14 +576,82 @@ HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferWhenPatternAllocationI
         nullptr);
     ASSERT_EQ(CL_SUCCESS, retVal);
 
-    ASSERT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
+    ASSERT_FALSE(csr.getAllocationsForReuse().peekIsEmpty());
 
-    GraphicsAllocation *patternAllocation = csr.getTemporaryAllocations().peekHead();
+    GraphicsAllocation *patternAllocation = csr.getAllocationsForReuse().peekHead();
     ASSERT_NE(nullptr, patternAllocation);
 
     EXPECT_EQ(GraphicsAllocation::AllocationType::FILL_PATTERN, patternAllocation->getAllocationType());
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferCalledTwiceWhenPatternAllocationIsCompletedThenItIsReused) {
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> dstBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, EnqueueFillBufferLargePatternTraits::size, nullptr, retVal));
+
+    EnqueueFillBufferHelper<EnqueueFillBufferLargePatternTraits>::enqueueFillBuffer(pCmdQ, dstBuffer.get());
+    ASSERT_FALSE(csr.getAllocationsForReuse().peekIsEmpty());
+    GraphicsAllocation *patternAllocation = csr.getAllocationsForReuse().peekHead();
+    EXPECT_EQ(nullptr, patternAllocation->next);
+
+    *csr.getTagAddress() = pCmdQ->taskCount;
+    EnqueueFillBufferHelper<EnqueueFillBufferLargePatternTraits>::enqueueFillBuffer(pCmdQ, dstBuffer.get());
+
+    EXPECT_EQ(patternAllocation, csr.getAllocationsForReuse().peekHead());
+    EXPECT_EQ(nullptr, csr.getAllocationsForReuse().peekHead()->next);
+    EXPECT_EQ(pCmdQ->taskCount, patternAllocation->getTaskCount(csr.getOsContext().getContextId()));
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenSmallPatternWhenFillingBufferThenPatternIsPassedByValueWithoutPatternAllocation) {
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    EnqueueFillBufferHelper<>::enqueueFillBuffer(pCmdQ, buffer);
+
+    EXPECT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    auto &builder = pCmdQ->getDevice().getExecutionEnvironment()->getBuiltIns()->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer,
+                                                                                                                 pCmdQ->getContext(), pCmdQ->getDevice());
+    uint32_t pattern[maxImmediateFillPatternSize / sizeof(uint32_t)] = {0x11223344u};
+    BuiltinOpParams dc;
+    dc.srcPtr = pattern;
+    dc.patternSize = sizeof(uint32_t);
+    dc.dstMemObj = buffer;
+    dc.dstOffset = {0, 0, 0};
+    dc.size = {MemoryConstants::cacheLineSize, 0, 0};
+
+    MultiDispatchInfo mdi;
+    EXPECT_TRUE(builder.buildDispatchInfos(mdi, dc));
+    ASSERT_EQ(1u, mdi.size());
+
+    auto kernel = mdi.begin()->getKernel();
+    EXPECT_STREQ("FillBufferImmediateMiddle", kernel->getKernelInfo().name.c_str());
+}
+
+HWTEST_F(EnqueueFillBufferCmdTests, givenBuiltinsWithoutImmediateKernelsWhenFillingBufferWithSmallPatternThenPatternAllocationIsUsed) {
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+
+    auto builtIns = new MockBuiltins();
+    pCmdQ->getDevice().getExecutionEnvironment()->builtins.reset(builtIns);
+    auto &origBuilder = builtIns->getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, pCmdQ->getContext(), pCmdQ->getDevice());
+    auto oldBuilder = builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, pCmdQ->getContext(), pCmdQ->getDevice(),
+                                                              std::unique_ptr<BuiltinDispatchInfoBuilder>(new MockFillBufferBuilderWithoutImmediateKernels(*builtIns, &origBuilder)));
+
+    auto retVal = EnqueueFillBufferHelper<>::enqueueFillBuffer(pCmdQ, buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto mockBuilder = builtIns->setBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, pCmdQ->getContext(), pCmdQ->getDevice(), std::move(oldBuilder));
+    EXPECT_NE(nullptr, static_cast<MockFillBufferBuilderWithoutImmediateKernels *>(mockBuilder.get())->getBuiltinOpParams()->srcMemObj);
+
+    GraphicsAllocation *patternAllocation = csr.getAllocationsForReuse().peekHead();
+    ASSERT_NE(nullptr, patternAllocation);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::FILL_PATTERN, patternAllocation->getAllocationType());
+}
+
 struct EnqueueFillBufferHw : public ::testing::Test {
 
     void SetUp() override {
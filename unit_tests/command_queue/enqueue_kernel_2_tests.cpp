@@ -701,6 +701,7 @@ struct EnqueueAuxKernelTests : public EnqueueKernelTest {
 
     void SetUp() override {
         DebugManager.flags.ForceAuxTranslationMode.set(static_cast<int32_t>(AuxTranslationMode::Builtin));
+        DebugManager.flags.EnableDeferredAuxTranslation.set(false);
         EnqueueKernelTest::SetUp();
     }
 
@@ -813,6 +814,143 @@ HWTEST_F(EnqueueAuxKernelTests, givenKernelWithRequiredAuxTranslationWhenEnqueue
     EXPECT_TRUE(kernelAfter->isBuiltIn);
 }
 
+HWTEST_F(EnqueueAuxKernelTests, givenDeferredAuxTranslationWhenSameBufferIsUsedByConsecutiveKernelsThenTranslateItOnlyOnceUntilFinish) {
+    DebugManager.flags.EnableDeferredAuxTranslation.set(true);
+
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+
+    ASSERT_EQ(1u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::AuxToNonAux, cmdQ.auxTranslationDirections[0]);
+    EXPECT_EQ(&cmdQ, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(2u, cmdQ.getAuxTranslationStatistics().translationsAvoided);
+
+    cmdQ.finish();
+
+    ASSERT_EQ(2u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, cmdQ.auxTranslationDirections[1]);
+    EXPECT_EQ(&buffer, *std::get<MemObjsForAuxTranslation>(cmdQ.dispatchAuxTranslationInputs.at(1)).begin());
+    EXPECT_EQ(nullptr, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(1u, cmdQ.getAuxTranslationStatistics().deferredTranslationsRestored);
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenDeferredAuxTranslationWhenKernelIsEnqueuedWithEventThenTranslateBackImmediately) {
+    DebugManager.flags.EnableDeferredAuxTranslation.set(true);
+
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cl_event event = nullptr;
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event);
+
+    ASSERT_EQ(2u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, cmdQ.auxTranslationDirections[1]);
+    EXPECT_EQ(nullptr, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(0u, cmdQ.getAuxTranslationStatistics().translationsAvoided);
+
+    clReleaseEvent(event);
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenBufferDeferredOnOneQueueWhenKernelOnAnotherQueueUsesItThenTranslationIsTakenOverByThatQueue) {
+    DebugManager.flags.EnableDeferredAuxTranslation.set(true);
+
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MockBuffer buffer;
+    cl_mem clMem = &buffer;
+    MyCmdQ<FamilyType> cmdQ0(context, pDevice);
+    MyCmdQ<FamilyType> cmdQ1(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    auto initialRefInternalCount = buffer.getRefInternalCount();
+
+    buffer.getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ0.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(&cmdQ0, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(initialRefInternalCount + 1, buffer.getRefInternalCount());
+
+    cmdQ1.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_TRUE(cmdQ1.auxTranslationDirections.empty());
+    EXPECT_EQ(&cmdQ1, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(2u, cmdQ1.getAuxTranslationStatistics().translationsAvoided);
+    EXPECT_EQ(initialRefInternalCount + 2, buffer.getRefInternalCount());
+
+    cmdQ0.finish();
+    ASSERT_EQ(1u, cmdQ0.auxTranslationDirections.size());
+    EXPECT_EQ(0u, cmdQ0.getAuxTranslationStatistics().deferredTranslationsRestored);
+    EXPECT_EQ(&cmdQ1, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(initialRefInternalCount + 1, buffer.getRefInternalCount());
+
+    cmdQ1.finish();
+    ASSERT_EQ(1u, cmdQ1.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, cmdQ1.auxTranslationDirections[0]);
+    EXPECT_EQ(1u, cmdQ1.getAuxTranslationStatistics().deferredTranslationsRestored);
+    EXPECT_EQ(nullptr, buffer.getDeferredAuxTranslationQueue());
+    EXPECT_EQ(initialRefInternalCount, buffer.getRefInternalCount());
+}
+
+HWTEST_F(EnqueueAuxKernelTests, givenDeferredBufferReleasedByUserWhenQueueTranslatesItBackThenBufferIsDestroyedAfterwards) {
+    DebugManager.flags.EnableDeferredAuxTranslation.set(true);
+
+    MockKernelWithInternals mockKernel(*pDevice, context);
+    MyCmdQ<FamilyType> cmdQ(context, pDevice);
+    size_t gws[3] = {1, 0, 0};
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = Buffer::create(context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal);
+    ASSERT_NE(nullptr, buffer);
+    cl_mem clMem = buffer;
+
+    buffer->getGraphicsAllocation()->setAllocationType(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
+    mockKernel.kernelInfo.kernelArgInfo.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).kernelArgPatchInfoVector.resize(1);
+    mockKernel.kernelInfo.kernelArgInfo.at(0).pureStatefulBufferAccess = false;
+    mockKernel.mockKernel->initialize();
+    mockKernel.mockKernel->auxTranslationRequired = true;
+    mockKernel.mockKernel->setArgBuffer(0, sizeof(cl_mem *), &clMem);
+
+    cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(&cmdQ, buffer->getDeferredAuxTranslationQueue());
+
+    buffer->release();
+    EXPECT_EQ(0, buffer->getRefApiCount());
+    EXPECT_EQ(1, buffer->getRefInternalCount());
+
+    cmdQ.finish();
+    ASSERT_EQ(2u, cmdQ.auxTranslationDirections.size());
+    EXPECT_EQ(AuxTranslationDirection::NonAuxToAux, cmdQ.auxTranslationDirections[1]);
+    EXPECT_EQ(1u, cmdQ.getAuxTranslationStatistics().deferredTranslationsRestored);
+}
+
 HWTEST_F(EnqueueAuxKernelTests, givenDebugVariableDisablingBuiltinTranslationWhenDispatchingKernelWithRequiredAuxTranslationThenDontDispatch) {
     DebugManager.flags.ForceAuxTranslationMode.set(static_cast<int32_t>(AuxTranslationMode::Blit));
     pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
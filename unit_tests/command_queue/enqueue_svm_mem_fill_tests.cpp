@@ -65,6 +65,16 @@ HWTEST_P(EnqueueSvmMemFillTest, givenEnqueueSVMMemFillWhenUsingFillBufferBuilder
               pattern(pattern), patternSize(patternSize) {
         }
         void validateInput(const BuiltinOpParams &conf) const override {
+            if (conf.srcMemObj == nullptr) {
+                // small patterns are passed by value, replicated to at least a dword
+                ASSERT_NE(nullptr, conf.srcPtr);
+                EXPECT_EQ(std::max(patternSize, sizeof(uint32_t)), conf.patternSize);
+                auto immediatePattern = static_cast<const uint8_t *>(conf.srcPtr);
+                for (size_t i = 0; i < conf.patternSize; i++) {
+                    EXPECT_EQ(static_cast<const uint8_t *>(pattern)[i % patternSize], immediatePattern[i]);
+                }
+                return;
+            }
             auto patternAllocation = conf.srcMemObj->getGraphicsAllocation();
             EXPECT_EQ(patternSize, patternAllocation->getUnderlyingBufferSize());
             EXPECT_EQ(0, memcmp(pattern, patternAllocation->getUnderlyingBuffer(), patternSize));
@@ -122,10 +132,11 @@ HWTEST_P(EnqueueSvmMemFillTest, givenEnqueueSVMMemFillWhenUsingFillBufferBuilder
     auto mockBuilder = static_cast<MockFillBufferBuilder *>(newBuilder.get());
 
     // validate builder's input - builtin ops
+    bool immediatePattern = patternSize <= maxImmediateFillPatternSize;
     auto params = mockBuilder->getBuiltinOpParams();
-    EXPECT_EQ(nullptr, params->srcPtr);
+    EXPECT_EQ(immediatePattern, nullptr != params->srcPtr);
     EXPECT_EQ(svmPtr, params->dstPtr);
-    EXPECT_NE(nullptr, params->srcMemObj);
+    EXPECT_EQ(immediatePattern, nullptr == params->srcMemObj);
     EXPECT_EQ(nullptr, params->dstMemObj);
     EXPECT_EQ(nullptr, params->srcSvmAlloc);
     EXPECT_EQ(svmAlloc, params->dstSvmAlloc);
@@ -142,7 +153,7 @@ HWTEST_P(EnqueueSvmMemFillTest, givenEnqueueSVMMemFillWhenUsingFillBufferBuilder
     EXPECT_EQ(Vec3<size_t>(256 / middleElSize, 1, 1), di->getGWS());
 
     auto kernel = di->getKernel();
-    EXPECT_STREQ("FillBufferMiddle", kernel->getKernelInfo().name.c_str());
+    EXPECT_STREQ(immediatePattern ? "FillBufferImmediateMiddle" : "FillBufferMiddle", kernel->getKernelInfo().name.c_str());
 }
 
 INSTANTIATE_TEST_CASE_P(size_t,
@@ -707,7 +707,8 @@ TEST_F(EnqueueSvmTest, givenEnqueueSVMMemFillWhenPatternAllocationIsObtainedThen
     auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
     ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
 
-    const float pattern[1] = {1.2345f};
+    // patterns up to maxImmediateFillPatternSize are passed by value
+    const float pattern[8] = {1.2345f};
     const size_t patternSize = sizeof(pattern);
     const size_t size = patternSize;
     retVal = this->pCmdQ->enqueueSVMMemFill(
@@ -728,6 +729,28 @@ TEST_F(EnqueueSvmTest, givenEnqueueSVMMemFillWhenPatternAllocationIsObtainedThen
     EXPECT_EQ(GraphicsAllocation::AllocationType::FILL_PATTERN, patternAllocation->getAllocationType());
 }
 
+TEST_F(EnqueueSvmTest, givenSmallPatternWhenEnqueueSVMMemFillThenNoPatternAllocationIsUsed) {
+    auto &csr = pCmdQ->getGpgpuCommandStreamReceiver();
+    ASSERT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    ASSERT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    const float pattern[1] = {1.2345f};
+    const size_t patternSize = sizeof(pattern);
+    const size_t size = patternSize;
+    retVal = this->pCmdQ->enqueueSVMMemFill(
+        ptrSVM,
+        pattern,
+        patternSize,
+        size,
+        0,
+        nullptr,
+        nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+}
+
 TEST_F(EnqueueSvmTest, GivenSvmAllocationWhenEnqueingKernelThenSuccessIsReturned) {
     auto svmData = context->getSVMAllocsManager()->getSVMAlloc(ptrSVM);
     ASSERT_NE(nullptr, svmData);
@@ -80,14 +80,16 @@ HWTEST_F(GetSizeRequiredBufferTest, WhenFillingBufferThenHeapsAndCommandBufferCo
                                                                                                                pCmdQ->getContext(), pCmdQ->getDevice());
     ASSERT_NE(nullptr, &builder);
 
+    // pattern fits in the kernel argument, so it is passed by value
+    ASSERT_LE(EnqueueFillBufferTraits::patternSize, maxImmediateFillPatternSize);
+    uint32_t immediatePattern[maxImmediateFillPatternSize / sizeof(uint32_t)] = {};
     BuiltinOpParams dc;
-    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(EnqueueFillBufferTraits::patternSize, 4), patternAllocation->getUnderlyingBuffer(),
-                         patternAllocation->getUnderlyingBuffer(), patternAllocation, false, false, true);
-    dc.srcMemObj = &patternMemObj;
+    dc.srcPtr = immediatePattern;
+    dc.patternSize = EnqueueFillBufferTraits::patternSize;
     dc.dstMemObj = dstBuffer;
     dc.dstOffset = {EnqueueFillBufferTraits::offset, 0, 0};
     dc.size = {EnqueueFillBufferTraits::size, 0, 0};
-    builder.buildDispatchInfos(multiDispatchInfo, dc);
+    EXPECT_TRUE(builder.buildDispatchInfos(multiDispatchInfo, dc));
     EXPECT_NE(0u, multiDispatchInfo.size());
 
     auto usedAfterCS = commandStream.getUsed();
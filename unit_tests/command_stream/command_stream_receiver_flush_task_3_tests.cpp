@@ -1643,3 +1643,18 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenWaitForCompletionWithTimeoutI
     mockCsr.submissionAggregator->recordCommandBuffer(cmdBuffer.release());
     EXPECT_FALSE(mockCsr.waitForCompletionWithTimeout(false, 0, 1));
 }
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenUnchangedStateWhenFlushingTwiceThenStateCommandsAreProgrammedOnlyOnce) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    flushTask(commandStreamReceiver);
+    auto &counters = commandStreamReceiver.peekStateProgrammingCounters();
+    EXPECT_EQ(1u, counters.preamble);
+    EXPECT_EQ(1u, counters.mediaVfeState);
+    EXPECT_EQ(1u, counters.stateBaseAddress);
+
+    flushTask(commandStreamReceiver);
+    EXPECT_EQ(1u, counters.preamble);
+    EXPECT_EQ(1u, counters.mediaVfeState);
+    EXPECT_EQ(1u, counters.stateBaseAddress);
+}
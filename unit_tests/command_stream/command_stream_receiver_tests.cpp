@@ -119,6 +119,20 @@ TEST_F(CommandStreamReceiverTest, commandStreamReceiverFromDeviceHasATagValue) {
     EXPECT_NE(nullptr, const_cast<uint32_t *>(commandStreamReceiver->getTagAddress()));
 }
 
+TEST_F(CommandStreamReceiverTest, givenCompletionWaitPolicySetWhenWaitingForCompletionThenPolicyIsUsed) {
+    auto waitPolicy = new CompletionWaitPolicy();
+    commandStreamReceiver->setCompletionWaitPolicy(waitPolicy);
+    EXPECT_EQ(waitPolicy, &commandStreamReceiver->getCompletionWaitPolicy());
+
+    auto taskCountToWait = *commandStreamReceiver->getTagAddress() + 1;
+    EXPECT_FALSE(commandStreamReceiver->waitForCompletionWithTimeout(true, 1000, taskCountToWait));
+    EXPECT_EQ(1u, waitPolicy->peekStatistics().waits);
+    EXPECT_EQ(1u, waitPolicy->peekStatistics().timeouts);
+
+    EXPECT_TRUE(commandStreamReceiver->waitForCompletionWithTimeout(true, 1000, taskCountToWait - 1));
+    EXPECT_EQ(1u, waitPolicy->peekStatistics().waits);
+}
+
 TEST_F(CommandStreamReceiverTest, GetCommandStreamReturnsValidObject) {
     auto &cs = commandStreamReceiver->getCS();
     EXPECT_NE(nullptr, &cs);
@@ -524,6 +538,44 @@ TEST_F(ReducedAddrSpaceCommandStreamReceiverTest,
     EXPECT_FALSE(result);
 }
 
+TEST_F(CommandStreamReceiverTest, givenHostPtrAllocationCacheEnabledWhenAllocationForSameHostSurfaceIsCreatedAgainThenCachedAllocationIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostPtrAllocationCacheBudgetInKB.set(1024);
+    auto memory = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+
+    HostPtrSurface surface(memory, MemoryConstants::pageSize);
+    ASSERT_TRUE(commandStreamReceiver->createAllocationForHostSurface(surface, false));
+    auto allocation = surface.getAllocation();
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_FALSE(commandStreamReceiver->getTemporaryAllocations().peekContains(*allocation));
+    EXPECT_EQ(1u, internalAllocationStorage->getHostPtrAllocationsCount());
+
+    HostPtrSurface smallerSurface(memory, MemoryConstants::pageSize / 2);
+    ASSERT_TRUE(commandStreamReceiver->createAllocationForHostSurface(smallerSurface, true));
+    EXPECT_EQ(allocation, smallerSurface.getAllocation());
+    EXPECT_TRUE(allocation->isFlushL3Required());
+    EXPECT_EQ(1u, internalAllocationStorage->peekReuseStatistics().hostPtrHits.load());
+
+    memoryManager->releaseHostPtrAllocationsOnAllEngines(memory, MemoryConstants::pageSize);
+    EXPECT_EQ(0u, internalAllocationStorage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(commandStreamReceiver->getTemporaryAllocations().peekContains(*allocation));
+
+    internalAllocationStorage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
+    alignedFree(memory);
+}
+
+TEST_F(CommandStreamReceiverTest, givenDefaultHostPtrAllocationCacheBudgetWhenAllocationForHostSurfaceIsCreatedThenItIsStoredAsTemporary) {
+    EXPECT_EQ(0u, commandStreamReceiver->getHostPtrAllocationCacheBudget());
+    char memory[8] = {};
+
+    HostPtrSurface surface(memory, sizeof(memory));
+    ASSERT_TRUE(commandStreamReceiver->createAllocationForHostSurface(surface, false));
+    EXPECT_TRUE(commandStreamReceiver->getTemporaryAllocations().peekContains(*surface.getAllocation()));
+    EXPECT_EQ(0u, internalAllocationStorage->getHostPtrAllocationsCount());
+
+    internalAllocationStorage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
+}
+
 TEST_F(CommandStreamReceiverTest, givenMinimumSizeDoesNotExceedCurrentWhenCallingEnsureCommandBufferAllocationThenDoNotReallocate) {
     GraphicsAllocation *allocation = memoryManager->allocateGraphicsMemoryWithProperties({commandStreamReceiver->getRootDeviceIndex(), 128u, GraphicsAllocation::AllocationType::COMMAND_BUFFER});
     LinearStream commandStream{allocation};
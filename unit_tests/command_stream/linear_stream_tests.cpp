@@ -28,6 +28,21 @@ TEST(LinearStreamCtorTest, whenProvidedAllArgumentsThenExpectSameValuesSet) {
     EXPECT_EQ(gfxAllocation, linearStream.getGraphicsAllocation());
 }
 
+TEST(LinearStreamCtorTest, whenCreatingLinearStreamsThenEachGetsUniqueBufferGeneration) {
+    LinearStream linearStream1;
+    LinearStream linearStream2;
+    EXPECT_NE(linearStream1.getBufferGeneration(), linearStream2.getBufferGeneration());
+}
+
+TEST_F(LinearStreamTest, whenReplacingBufferThenBufferGenerationChanges) {
+    auto initialGeneration = linearStream.getBufferGeneration();
+    linearStream.getSpace(sizeof(uint32_t));
+    EXPECT_EQ(initialGeneration, linearStream.getBufferGeneration());
+
+    linearStream.replaceBuffer(linearStream.getCpuBase(), linearStream.getMaxAvailableSpace());
+    EXPECT_NE(initialGeneration, linearStream.getBufferGeneration());
+}
+
 TEST_F(LinearStreamTest, getSpaceTestSizeZero) {
     EXPECT_NE(nullptr, linearStream.getSpace(0));
 }
@@ -191,7 +191,7 @@ TEST(DeviceCreation, givenMultiRootDeviceWhenTheyAreCreatedThenEachOsContextHasU
     auto device1 = std::unique_ptr<MockDevice>(Device::create<MockDevice>(executionEnvironment, 0u));
     auto device2 = std::unique_ptr<MockDevice>(Device::create<MockDevice>(executionEnvironment, 1u));
 
-    auto &registeredEngines = executionEnvironment->memoryManager->getRegisteredEngines();
+    auto registeredEngines = executionEnvironment->memoryManager->getRegisteredEngines();
     EXPECT_EQ(numGpgpuEngines * numDevices, registeredEngines.size());
 
     for (uint32_t i = 0; i < numGpgpuEngines; i++) {
@@ -260,6 +260,58 @@ TEST(DeviceCreation, givenDeviceWhenCheckingEnginesCountThenNumberGreaterThanZer
     EXPECT_GT(DeviceHelper::getEnginesCount(device->getHardwareInfo()), 0u);
 }
 
+TEST(DeviceCreation, givenLazyEngineInitializationWhenDeviceIsCreatedThenOnlyDefaultEngineIsCreated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LazyEngineInitialization.set(true);
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto numGpgpuEngines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances().size();
+
+    EXPECT_EQ(1u, device->engines.size());
+    EXPECT_EQ(numGpgpuEngines - 1, device->lazyEngines.size());
+    EXPECT_EQ(1u, device->getMemoryManager()->getRegisteredEnginesCount());
+    EXPECT_EQ(&device->engines[0], &device->getDefaultEngine());
+    EXPECT_FALSE(device->getDefaultEngine().osContext->isLowPriority());
+}
+
+TEST(DeviceCreation, givenLazyEngineInitializationWhenLowPriorityEngineIsRequestedThenItIsCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LazyEngineInitialization.set(true);
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto gpgpuEngines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances();
+    auto lowPriorityEngineType = gpgpuEngines[HwHelper::lowPriorityGpgpuEngineIndex];
+    auto defaultEngine = &device->getDefaultEngine();
+    auto registeredEnginesCount = device->getMemoryManager()->getRegisteredEnginesCount();
+
+    auto &lowPriorityEngine = device->getEngine(lowPriorityEngineType, true);
+    EXPECT_TRUE(lowPriorityEngine.osContext->isLowPriority());
+    EXPECT_EQ(lowPriorityEngineType, lowPriorityEngine.osContext->getEngineType());
+    EXPECT_NE(nullptr, lowPriorityEngine.commandStreamReceiver->getTagAddress());
+    EXPECT_EQ(registeredEnginesCount + 1, device->getMemoryManager()->getRegisteredEnginesCount());
+    EXPECT_EQ(gpgpuEngines.size() - 2, device->lazyEngines.size());
+
+    EXPECT_EQ(&lowPriorityEngine, &device->getEngine(lowPriorityEngineType, true));
+    EXPECT_EQ(registeredEnginesCount + 1, device->getMemoryManager()->getRegisteredEnginesCount());
+    EXPECT_EQ(defaultEngine, &device->getDefaultEngine());
+}
+
+TEST(DeviceCreation, givenParallelDeviceInitializationWhenDeviceIsCreatedThenEnginesAreCreatedInSerialOrder) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelDeviceInitialization.set(true);
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto gpgpuEngines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances();
+    auto registeredEngines = device->getMemoryManager()->getRegisteredEngines();
+
+    ASSERT_EQ(gpgpuEngines.size(), device->engines.size());
+    for (uint32_t i = 0; i < gpgpuEngines.size(); i++) {
+        EXPECT_EQ(gpgpuEngines[i], device->engines[i].osContext->getEngineType());
+        EXPECT_EQ(i == HwHelper::lowPriorityGpgpuEngineIndex, device->engines[i].osContext->isLowPriority());
+        EXPECT_EQ(registeredEngines[i].commandStreamReceiver, device->engines[i].commandStreamReceiver);
+        EXPECT_NE(nullptr, device->engines[i].commandStreamReceiver->getTagAddress());
+    }
+    EXPECT_EQ(platformDevices[0]->capabilityTable.defaultEngineType, device->getDefaultEngine().osContext->getEngineType());
+    EXPECT_FALSE(device->getDefaultEngine().osContext->isLowPriority());
+}
+
 using DeviceHwTest = ::testing::Test;
 
 HWTEST_F(DeviceHwTest, givenHwHelperInputWhenInitializingCsrThenCreatePageTableManagerIfAllowed) {
@@ -6,6 +6,7 @@
  */
 
 #include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/event/async_events_handler.h"
 #include "runtime/event/event.h"
 #include "runtime/event/user_event.h"
@@ -13,6 +14,9 @@
 #include "runtime/platform/platform.h"
 #include "test.h"
 #include "unit_tests/mocks/mock_async_event_handler.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
 
 #include "gmock/gmock.h"
 
@@ -367,3 +371,156 @@ TEST_F(AsyncEventsHandlerTests, asyncProcessCallsProcessListBeforeReturning) {
 
     event->release();
 }
+
+class AsyncEventsHandlerCompletionOrderTests : public ::testing::Test {
+  public:
+    class CountingEvent : public Event {
+      public:
+        CountingEvent(CommandQueue *cmdQueue, uint32_t taskCount)
+            : Event(cmdQueue, CL_COMMAND_NDRANGE_KERNEL, 0, taskCount) {}
+
+        void updateExecutionStatus() override {
+            ++updateCount;
+            Event::updateExecutionStatus();
+        }
+
+        std::atomic<int> updateCount{0};
+    };
+
+    static void CL_CALLBACK callbackFcn(cl_event e, cl_int status, void *data) {
+        ++(*reinterpret_cast<std::atomic<int> *>(data));
+    }
+
+    void SetUp() override {
+        DebugManager.flags.EnableAsyncEventsHandler.set(false);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        context.reset(new MockContext(device.get()));
+        cmdQ.reset(new MockCommandQueue(context.get(), device.get(), nullptr));
+        tagAddress = cmdQ->getGpgpuCommandStreamReceiver().getTagAddress();
+        *tagAddress = 0;
+        handler.reset(new MockHandler());
+    }
+
+    void TearDown() override {
+        handler.reset();
+        for (auto event : events) {
+            event->release();
+        }
+    }
+
+    CountingEvent *createEventWithCallback(uint32_t taskCount) {
+        auto event = new CountingEvent(cmdQ.get(), taskCount);
+        event->addCallback(&callbackFcn, CL_COMPLETE, &callbackCounter);
+        events.push_back(event);
+        return event;
+    }
+
+    DebugManagerStateRestore dbgRestore;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<MockCommandQueue> cmdQ;
+    std::unique_ptr<MockHandler> handler;
+    std::vector<CountingEvent *> events;
+    std::atomic<int> callbackCounter{0};
+    volatile uint32_t *tagAddress = nullptr;
+};
+
+TEST_F(AsyncEventsHandlerCompletionOrderTests, givenSubmittedEventsWhenTagIsNotReachedThenTheyAreNotUpdatedAgain) {
+    for (uint32_t taskCount = 1; taskCount <= 3; taskCount++) {
+        handler->registerEvent(createEventWithCallback(taskCount));
+    }
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(events[0], sleepCandidate);
+    EXPECT_EQ(1u, handler->completionHeaps.size());
+
+    for (int i = 0; i < 3; i++) {
+        sleepCandidate = handler->process();
+    }
+    EXPECT_EQ(events[0], sleepCandidate);
+    for (auto event : events) {
+        EXPECT_EQ(CL_SUBMITTED, event->peekExecutionStatus());
+        EXPECT_EQ(1, event->updateCount);
+    }
+    EXPECT_EQ(0, callbackCounter);
+}
+
+TEST_F(AsyncEventsHandlerCompletionOrderTests, givenTagReachedWhenListIsProcessedThenOnlyCompletedEventsAreUpdated) {
+    for (uint32_t taskCount = 1; taskCount <= 3; taskCount++) {
+        handler->registerEvent(createEventWithCallback(taskCount));
+    }
+    handler->process();
+
+    *tagAddress = 2;
+    auto sleepCandidate = handler->process();
+
+    EXPECT_EQ(events[2], sleepCandidate);
+    EXPECT_EQ(2, callbackCounter);
+    EXPECT_EQ(CL_COMPLETE, events[0]->peekExecutionStatus());
+    EXPECT_EQ(CL_COMPLETE, events[1]->peekExecutionStatus());
+    EXPECT_EQ(CL_SUBMITTED, events[2]->peekExecutionStatus());
+    EXPECT_EQ(2, events[0]->updateCount);
+    EXPECT_EQ(2, events[1]->updateCount);
+    EXPECT_EQ(1, events[2]->updateCount);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *tagAddress = 3;
+    sleepCandidate = handler->process();
+
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(3, callbackCounter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+    for (auto event : events) {
+        EXPECT_EQ(1, event->getRefInternalCount());
+    }
+}
+
+TEST_F(AsyncEventsHandlerCompletionOrderTests, givenEventsInCompletionHeapWhenHandlerIsDestroyedThenUnreferenceAll) {
+    auto event = createEventWithCallback(1);
+    handler->registerEvent(event);
+    handler->process();
+    EXPECT_EQ(1u, handler->completionHeaps.size());
+    EXPECT_EQ(3, event->getRefInternalCount());
+
+    handler.reset();
+    // 1 left because of callback
+    EXPECT_EQ(2, event->getRefInternalCount());
+
+    *tagAddress = 1;
+    event->updateExecutionStatus();
+    EXPECT_EQ(1, callbackCounter);
+}
+
+TEST_F(AsyncEventsHandlerCompletionOrderTests, givenCallbackWorkersWhenEventsCompleteThenAllCallbacksAreDispatched) {
+    constexpr uint32_t numEvents = 16;
+    handler->openCallbackWorkers(2);
+    EXPECT_EQ(2u, handler->callbackWorkers.size());
+
+    for (uint32_t taskCount = 1; taskCount <= numEvents; taskCount++) {
+        handler->registerEvent(createEventWithCallback(taskCount));
+    }
+    handler->process();
+
+    *tagAddress = numEvents / 2;
+    handler->process();
+    EXPECT_EQ(static_cast<int>(numEvents / 2), callbackCounter);
+
+    *tagAddress = numEvents;
+    handler->process();
+    EXPECT_EQ(static_cast<int>(numEvents), callbackCounter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+
+    handler->closeCallbackWorkers();
+    EXPECT_TRUE(handler->callbackWorkers.empty());
+}
+
+TEST_F(AsyncEventsHandlerCompletionOrderTests, givenCallbackThreadsDebugFlagWhenThreadIsOpenedThenCreateCallbackWorkers) {
+    DebugManager.flags.AsyncEventsHandlerCallbackThreads.set(3);
+    MockHandler myHandler(true);
+    myHandler.openThread();
+    EXPECT_EQ(3u, myHandler.callbackWorkers.size());
+
+    myHandler.closeThread();
+    EXPECT_TRUE(myHandler.callbackWorkers.empty());
+    EXPECT_EQ(nullptr, myHandler.thread.get());
+}
@@ -215,6 +215,50 @@ TEST(Event, waitForEventsWithNotReadyEventDoesNotFlushQueue) {
     EXPECT_EQ(0u, cmdQ1->flushCounter);
 }
 
+TEST(Event, givenEventsFromSameQueueWhenWaitingForEventsThenQueueIsFlushedAndWaitedOnOnceForHighestTaskCount) {
+    class MockCommandQueueWithWaitCheck : public MockCommandQueue {
+      public:
+        MockCommandQueueWithWaitCheck(Context &context, Device *device) : MockCommandQueue(&context, device, nullptr) {
+        }
+        cl_int flush() override {
+            flushCounter++;
+            return CL_SUCCESS;
+        }
+        void waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) override {
+            waitCounter++;
+            waitedTaskCount = taskCountToWait;
+            waitedFlushStamp = flushStampToWait;
+            *getGpgpuCommandStreamReceiver().getTagAddress() = taskCountToWait;
+        }
+        uint32_t flushCounter = 0;
+        uint32_t waitCounter = 0;
+        uint32_t waitedTaskCount = 0;
+        FlushStamp waitedFlushStamp = 0;
+    };
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+
+    MockCommandQueueWithWaitCheck cmdQ(context, device.get());
+    std::vector<std::unique_ptr<Event>> events;
+    std::vector<cl_event> eventWaitlist;
+    for (uint32_t taskCount = 1; taskCount <= 100; taskCount++) {
+        events.emplace_back(new Event(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, taskCount, taskCount));
+        events.back()->flushStamp->setStamp(taskCount * 2);
+        eventWaitlist.push_back(events.back().get());
+    }
+
+    EXPECT_EQ(CL_SUCCESS, Event::waitForEvents(static_cast<cl_uint>(eventWaitlist.size()), eventWaitlist.data()));
+
+    EXPECT_EQ(1u, cmdQ.flushCounter);
+    EXPECT_EQ(1u, cmdQ.waitCounter);
+    EXPECT_EQ(100u, cmdQ.waitedTaskCount);
+    EXPECT_EQ(200u, cmdQ.waitedFlushStamp);
+    for (auto &event : events) {
+        EXPECT_EQ(CL_COMPLETE, event->peekExecutionStatus());
+    }
+}
+
 TEST(Event, givenNotReadyEventOnWaitlistWhenCheckingUserEventDependeciesThenTrueIsReturned) {
     auto event1 = std::make_unique<Event>(nullptr, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, 0);
     cl_event eventWaitlist[] = {event1.get()};
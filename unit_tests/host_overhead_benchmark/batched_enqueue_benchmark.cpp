@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/api/api.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+// Reports enqueue throughput when several host threads enqueue onto their own queues that share
+// the default command stream receiver in batched dispatch mode. Recording and flushing of command
+// buffers serialize on the CSR ownership lock, this shows how throughput scales with the thread count.
+struct BatchedEnqueueBenchmark : public DeviceFixture,
+                                 public ::testing::Test {
+    static constexpr uint32_t enqueuesPerThread = 2000;
+    static constexpr uint32_t flushInterval = 64;
+
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        pDevice->getDefaultEngine().commandStreamReceiver->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+        context.reset(new MockContext(pDevice));
+    }
+
+    void TearDown() override {
+        context.reset();
+        DeviceFixture::TearDown();
+    }
+
+    double measureEnqueuesPerSecond(uint32_t numThreads) {
+        std::vector<CommandQueue *> commandQueues;
+        std::vector<std::unique_ptr<MockKernelWithInternals>> kernels;
+        for (uint32_t i = 0; i < numThreads; i++) {
+            cl_int retVal = CL_SUCCESS;
+            commandQueues.push_back(CommandQueue::create(context.get(), pDevice, nullptr, retVal));
+            EXPECT_EQ(CL_SUCCESS, retVal);
+            kernels.emplace_back(new MockKernelWithInternals(*pDevice, context.get()));
+        }
+
+        std::atomic<uint32_t> threadsReady{0};
+        std::atomic<bool> startEnqueues{false};
+        std::atomic<uint32_t> failedEnqueues{0};
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < numThreads; i++) {
+            threads.emplace_back([&, i]() {
+                size_t globalWorkSize[3] = {64, 1, 1};
+                threadsReady++;
+                while (!startEnqueues) {
+                    std::this_thread::yield();
+                }
+                for (uint32_t enqueue = 0; enqueue < enqueuesPerThread; enqueue++) {
+                    if (clEnqueueNDRangeKernel(commandQueues[i], kernels[i]->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr) != CL_SUCCESS) {
+                        failedEnqueues++;
+                    }
+                    if ((enqueue + 1) % flushInterval == 0) {
+                        clFlush(commandQueues[i]);
+                    }
+                }
+            });
+        }
+        while (threadsReady != numThreads) {
+            std::this_thread::yield();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        startEnqueues = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        EXPECT_EQ(0u, failedEnqueues);
+        for (auto commandQueue : commandQueues) {
+            EXPECT_EQ(CL_SUCCESS, clFinish(commandQueue));
+            commandQueue->release();
+        }
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(numThreads * enqueuesPerThread) / seconds;
+    }
+
+    std::unique_ptr<MockContext> context;
+};
+
+TEST_F(BatchedEnqueueBenchmark, clEnqueueNDRangeKernelFromMultipleThreadsOnSharedCsr) {
+    double singleThreadEnqueuesPerSecond = 0.0;
+    for (uint32_t numThreads = 1; numThreads <= 8; numThreads *= 2) {
+        auto enqueuesPerSecond = measureEnqueuesPerSecond(numThreads);
+        if (numThreads == 1) {
+            singleThreadEnqueuesPerSecond = enqueuesPerSecond;
+        }
+        auto scaling = enqueuesPerSecond / singleThreadEnqueuesPerSecond;
+        printf("%u threads %12.0f enqueues/s %6.2fx\n", numThreads, enqueuesPerSecond, scaling);
+        RecordProperty("threads" + std::to_string(numThreads) + ".enqueuesPerSecond", std::to_string(enqueuesPerSecond));
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/helpers/completion_wait_policy.h"
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <thread>
+
+using namespace NEO;
+
+// Compares CPU time and wake latency of spin and adaptive completion waits against a simulated
+// tag writer with fixed completion latency. Results are only printed and recorded as gtest
+// properties, timing never fails the run.
+struct CompletionWaitPolicyBenchmark : public ::testing::Test {
+    struct WaitMeasurement {
+        double cpuTimePercent = 0.0;
+        double averageWakeLatencyUs = 0.0;
+    };
+
+    static WaitMeasurement measureWaits(CompletionWaitPolicy &waitPolicy, std::chrono::microseconds completionLatency, uint32_t waitsCount) {
+        volatile uint32_t tag = 0;
+        std::atomic<uint32_t> submitted{0};
+        std::atomic<int64_t> tagWriteTimeNs{0};
+        std::atomic<bool> writerExit{false};
+
+        std::thread tagWriter([&] {
+            uint32_t written = 0;
+            while (!writerExit) {
+                if (submitted.load() == written) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::this_thread::sleep_for(completionLatency);
+                tagWriteTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+                tag = ++written;
+            }
+        });
+
+        double totalWakeLatencyUs = 0.0;
+        auto cpuStart = std::clock();
+        auto wallStart = std::chrono::steady_clock::now();
+        for (uint32_t i = 1; i <= waitsCount; i++) {
+            submitted = i;
+            waitPolicy.waitForCompletion(&tag, i, false, 0);
+            auto wakeTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            totalWakeLatencyUs += (wakeTimeNs - tagWriteTimeNs.load()) / 1000.0;
+        }
+        auto cpuTime = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        auto wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+        writerExit = true;
+        tagWriter.join();
+
+        // process cpu time includes the writer thread, which mostly sleeps
+        WaitMeasurement measurement;
+        measurement.cpuTimePercent = 100.0 * cpuTime / wallTime;
+        measurement.averageWakeLatencyUs = totalWakeLatencyUs / waitsCount;
+        return measurement;
+    }
+
+    void report(const std::string &name, const WaitMeasurement &measurement) {
+        printf("  %-10s cpu %6.1f%%  wake latency %10.1f us\n", name.c_str(), measurement.cpuTimePercent, measurement.averageWakeLatencyUs);
+        RecordProperty(name + ".cpuPercent", std::to_string(measurement.cpuTimePercent));
+        RecordProperty(name + ".wakeLatencyUs", std::to_string(measurement.averageWakeLatencyUs));
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(CompletionWaitPolicyBenchmark, SpinAndAdaptiveWaits) {
+    constexpr uint32_t waitsCount = 200;
+
+    for (auto latencyUs : {10, 100, 1000, 5000}) {
+        DebugManager.flags.OverrideCompletionWaitMode.set(static_cast<int32_t>(CompletionWaitPolicy::Mode::Spin));
+        CompletionWaitPolicy spinPolicy;
+        auto spin = measureWaits(spinPolicy, std::chrono::microseconds(latencyUs), waitsCount);
+
+        DebugManager.flags.OverrideCompletionWaitMode.set(static_cast<int32_t>(CompletionWaitPolicy::Mode::Adaptive));
+        CompletionWaitPolicy adaptivePolicy;
+        auto adaptive = measureWaits(adaptivePolicy, std::chrono::microseconds(latencyUs), waitsCount);
+
+        printf("completion latency %d us, learned %lld us, sleeps %llu\n", latencyUs,
+               static_cast<long long>(adaptivePolicy.getExpectedCompletionTimeMicroseconds()),
+               static_cast<unsigned long long>(adaptivePolicy.peekStatistics().sleeps.load()));
+        report("spin." + std::to_string(latencyUs), spin);
+        report("adaptive." + std::to_string(latencyUs), adaptive);
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/helpers/hash.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Reports throughput of Hash and Hash128 (compiler cache keys) for 1KB - 64MB inputs.
+// Results are only printed and recorded as gtest properties, timing never fails the run.
+struct HashBenchmark : public ::testing::Test {
+    template <typename HashFunction>
+    static double measureThroughputInMBps(const std::vector<char> &data, HashFunction &&hashFunction) {
+        const size_t iterations = std::max<size_t>(1u, (256 * MemoryConstants::megaByte) / data.size());
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            hashFunction(data.data(), data.size());
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(data.size() * iterations) / MemoryConstants::megaByte / seconds;
+    }
+};
+
+TEST_F(HashBenchmark, HashAndHash128Throughput) {
+    uint64_t hashSink = 0;
+    for (size_t size = MemoryConstants::kiloByte; size <= 64 * MemoryConstants::megaByte; size *= 4) {
+        std::vector<char> data(size);
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<char>(i * 31);
+        }
+
+        auto hashThroughput = measureThroughputInMBps(data, [&](const char *buff, size_t dataSize) {
+            hashSink ^= Hash::hash(buff, dataSize);
+        });
+        auto hash128Throughput = measureThroughputInMBps(data, [&](const char *buff, size_t dataSize) {
+            hashSink ^= Hash128::hash(buff, dataSize).low;
+        });
+
+        printf("%10zu B  Hash %10.1f MB/s  Hash128 %10.1f MB/s\n", size, hashThroughput, hash128Throughput);
+        RecordProperty("Hash." + std::to_string(size) + ".MBps", std::to_string(hashThroughput));
+        RecordProperty("Hash128." + std::to_string(size) + ".MBps", std::to_string(hash128Throughput));
+    }
+    // keeps hashing from being optimized out
+    RecordProperty("sink", std::to_string(hashSink % 2));
+}
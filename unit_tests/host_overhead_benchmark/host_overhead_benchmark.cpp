@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "core/unit_tests/helpers/memory_management.h"
+#include "runtime/api/api.h"
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/utilities/enqueue_phase_profiler.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/helpers/variable_backup.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace NEO;
+
+static std::atomic<uint64_t> heapAllocationsCount{0};
+
+static void countHeapAllocation(size_t) {
+    heapAllocationsCount++;
+}
+
+// Measures host side CPU time spent in a single API call on the stub command stream receiver,
+// so no GPU work is involved. Each benchmark reports average time per call, global heap allocations
+// per call and the split between enqueueHandler phases, both printed and recorded as gtest properties.
+struct HostOverheadBenchmark : public DeviceFixture,
+                               public ::testing::Test {
+    static constexpr uint32_t warmupIterations = 100;
+    static constexpr uint32_t iterations = 10000;
+    static constexpr size_t bufferSize = 4096;
+
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        context.reset(new MockContext(pDevice));
+
+        cl_int retVal = CL_SUCCESS;
+        commandQueue = CommandQueue::create(context.get(), pDevice, nullptr, retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+
+        kernel.reset(new MockKernelWithInternals(*pDevice, context.get(), true));
+        buffer = clCreateBuffer(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        ASSERT_EQ(CL_SUCCESS, clSetKernelArg(kernel->mockKernel, 0, sizeof(cl_mem), &buffer));
+        ASSERT_EQ(CL_SUCCESS, clSetKernelArg(kernel->mockKernel, 1, sizeof(cl_mem), &buffer));
+        memset(hostMemory, 0, sizeof(hostMemory));
+
+        profilerBackup.reset(new VariableBackup<EnqueuePhaseProfiler *>(&gEnqueuePhaseProfiler, &profiler));
+        allocateCallbackBackup.reset(new VariableBackup<void (*)(size_t)>(&MemoryManagement::allocateCallback, countHeapAllocation));
+    }
+
+    void TearDown() override {
+        allocateCallbackBackup.reset();
+        profilerBackup.reset();
+        clReleaseMemObject(buffer);
+        kernel.reset();
+        commandQueue->release();
+        context.reset();
+        DeviceFixture::TearDown();
+    }
+
+    template <typename OperationT>
+    void measure(const char *name, OperationT &&operation) {
+        for (uint32_t i = 0; i < warmupIterations; i++) {
+            ASSERT_EQ(CL_SUCCESS, operation());
+        }
+        clFinish(commandQueue);
+        profiler.reset();
+        auto allocationsAtStart = heapAllocationsCount.load();
+
+        uint32_t failedCalls = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            if (operation() != CL_SUCCESS) {
+                failedCalls++;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        ASSERT_EQ(0u, failedCalls);
+        auto totalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        auto allocations = heapAllocationsCount.load() - allocationsAtStart;
+        report(name, static_cast<double>(totalNs) / iterations, static_cast<double>(allocations) / iterations);
+        clFinish(commandQueue);
+    }
+
+    void report(const char *name, double nsPerCall, double allocationsPerCall) {
+        printf("%-32s %10.1f ns/call %8.2f allocations/call\n", name, nsPerCall, allocationsPerCall);
+        RecordProperty(std::string(name) + ".ns", std::to_string(nsPerCall));
+        RecordProperty(std::string(name) + ".allocations", std::to_string(allocationsPerCall));
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(EnqueuePhase::Count); i++) {
+            auto phase = static_cast<EnqueuePhase>(i);
+            auto calls = profiler.getCallsCount(phase);
+            if (calls == 0) {
+                continue;
+            }
+            auto phaseNsPerCall = static_cast<double>(profiler.getTotalTimeNs(phase)) / iterations;
+            auto phaseName = EnqueuePhaseProfiler::getPhaseName(phase);
+            printf("  %-30s %10.1f ns/call (%.2f calls)\n", phaseName, phaseNsPerCall, static_cast<double>(calls) / iterations);
+            RecordProperty(std::string(name) + "." + phaseName + ".ns", std::to_string(phaseNsPerCall));
+        }
+    }
+
+    EnqueuePhaseProfiler profiler;
+    std::unique_ptr<VariableBackup<EnqueuePhaseProfiler *>> profilerBackup;
+    std::unique_ptr<VariableBackup<void (*)(size_t)>> allocateCallbackBackup;
+    std::unique_ptr<MockContext> context;
+    CommandQueue *commandQueue = nullptr;
+    std::unique_ptr<MockKernelWithInternals> kernel;
+    cl_mem buffer = nullptr;
+    char hostMemory[bufferSize];
+    size_t globalWorkSize[3] = {64, 1, 1};
+};
+
+TEST_F(HostOverheadBenchmark, clEnqueueNDRangeKernel) {
+    measure("clEnqueueNDRangeKernel", [&]() {
+        return clEnqueueNDRangeKernel(commandQueue, kernel->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clEnqueueNDRangeKernelWithEvent) {
+    measure("clEnqueueNDRangeKernelWithEvent", [&]() {
+        cl_event event = nullptr;
+        auto retVal = clEnqueueNDRangeKernel(commandQueue, kernel->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, &event);
+        clReleaseEvent(event);
+        return retVal;
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clEnqueueNDRangeKernelWithEventWithoutObjectPooling) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(false);
+    measure("clEnqueueNDRangeKernelWithEventWithoutObjectPooling", [&]() {
+        cl_event event = nullptr;
+        auto retVal = clEnqueueNDRangeKernel(commandQueue, kernel->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, &event);
+        clReleaseEvent(event);
+        return retVal;
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clEnqueueNDRangeKernelWithoutDispatchTemplates) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableKernelDispatchTemplates.set(false);
+    size_t largeGlobalWorkSize[3] = {1024, 1, 1};
+    size_t largeLocalWorkSize[3] = {128, 1, 1};
+    measure("clEnqueueNDRangeKernelWithoutDispatchTemplates", [&]() {
+        return clEnqueueNDRangeKernel(commandQueue, kernel->mockKernel, 1, nullptr, largeGlobalWorkSize, largeLocalWorkSize, 0, nullptr, nullptr);
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clEnqueueNDRangeKernelWithDispatchTemplates) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableKernelDispatchTemplates.set(true);
+    size_t largeGlobalWorkSize[3] = {1024, 1, 1};
+    size_t largeLocalWorkSize[3] = {128, 1, 1};
+    measure("clEnqueueNDRangeKernelWithDispatchTemplates", [&]() {
+        return clEnqueueNDRangeKernel(commandQueue, kernel->mockKernel, 1, nullptr, largeGlobalWorkSize, largeLocalWorkSize, 0, nullptr, nullptr);
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clSetKernelArg) {
+    measure("clSetKernelArg", [&]() {
+        return clSetKernelArg(kernel->mockKernel, 0, sizeof(cl_mem), &buffer);
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clEnqueueWriteBuffer) {
+    measure("clEnqueueWriteBuffer", [&]() {
+        return clEnqueueWriteBuffer(commandQueue, buffer, CL_FALSE, 0, bufferSize, hostMemory, 0, nullptr, nullptr);
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clEnqueueMarkerWithWaitList) {
+    measure("clEnqueueMarkerWithWaitList", [&]() {
+        cl_event event = nullptr;
+        auto retVal = clEnqueueMarkerWithWaitList(commandQueue, 0, nullptr, &event);
+        clReleaseEvent(event);
+        return retVal;
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clCreateUserEventAndRelease) {
+    measure("clCreateUserEventAndRelease", [&]() {
+        cl_int retVal = CL_SUCCESS;
+        auto event = clCreateUserEvent(context.get(), &retVal);
+        clReleaseEvent(event);
+        return retVal;
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clFinishAfterNDRangeKernel) {
+    measure("clFinishAfterNDRangeKernel", [&]() {
+        clEnqueueNDRangeKernel(commandQueue, kernel->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+        return clFinish(commandQueue);
+    });
+}
+
+TEST_F(HostOverheadBenchmark, clFinishOnIdleQueue) {
+    measure("clFinishOnIdleQueue", [&]() {
+        return clFinish(commandQueue);
+    });
+}
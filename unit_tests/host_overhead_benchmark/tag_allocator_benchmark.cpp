@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/fixtures/device_fixture.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+// Reports getTag/returnTag throughput when several host threads share one TagAllocator,
+// with and without the per-thread caches of released tags.
+struct TagAllocatorBenchmark : public DeviceFixture,
+                               public ::testing::Test {
+    struct CompletedTag {
+        void initialize() {}
+        static GraphicsAllocation::AllocationType getAllocationType() {
+            return GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER;
+        }
+        bool isCompleted() const { return true; }
+        uint64_t data;
+    };
+
+    struct BenchmarkTagAllocator : public TagAllocator<CompletedTag> {
+        BenchmarkTagAllocator(MemoryManager *memoryManager, bool useThreadCaches)
+            : TagAllocator<CompletedTag>(0, memoryManager, 64, MemoryConstants::cacheLineSize, sizeof(CompletedTag), false) {
+            if (!useThreadCaches) {
+                this->threadCacheCapacity = 0;
+            }
+        }
+    };
+
+    static constexpr uint32_t tagsPerIteration = 8;
+    static constexpr uint32_t iterationsPerThread = 20000;
+
+    void SetUp() override {
+        DeviceFixture::SetUp();
+    }
+
+    void TearDown() override {
+        DeviceFixture::TearDown();
+    }
+
+    double measureTagsPerSecond(uint32_t numThreads, bool useThreadCaches) {
+        BenchmarkTagAllocator tagAllocator(pDevice->getMemoryManager(), useThreadCaches);
+
+        std::atomic<uint32_t> threadsReady{0};
+        std::atomic<bool> startThreads{false};
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0; i < numThreads; i++) {
+            threads.emplace_back([&]() {
+                TagNode<CompletedTag> *tags[tagsPerIteration] = {};
+                threadsReady++;
+                while (!startThreads) {
+                    std::this_thread::yield();
+                }
+                for (uint32_t iteration = 0; iteration < iterationsPerThread; iteration++) {
+                    for (auto &tag : tags) {
+                        tag = tagAllocator.getTag();
+                    }
+                    for (auto tag : tags) {
+                        tag->returnTag();
+                    }
+                }
+            });
+        }
+        while (threadsReady != numThreads) {
+            std::this_thread::yield();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        startThreads = true;
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<double>(numThreads * iterationsPerThread * tagsPerIteration) / seconds;
+    }
+};
+
+TEST_F(TagAllocatorBenchmark, getTagAndReturnTagFromMultipleThreads) {
+    for (uint32_t numThreads = 1; numThreads <= 8; numThreads *= 2) {
+        auto sharedListTagsPerSecond = measureTagsPerSecond(numThreads, false);
+        auto threadCacheTagsPerSecond = measureTagsPerSecond(numThreads, true);
+        printf("%u threads  free list %12.0f tags/s  thread caches %12.0f tags/s\n", numThreads, sharedListTagsPerSecond, threadCacheTagsPerSecond);
+        RecordProperty("threads" + std::to_string(numThreads) + ".freeList.tagsPerSecond", std::to_string(sharedListTagsPerSecond));
+        RecordProperty("threads" + std::to_string(numThreads) + ".threadCaches.tagsPerSecond", std::to_string(threadCacheTagsPerSecond));
+    }
+}
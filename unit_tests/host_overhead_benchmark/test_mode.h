@@ -0,0 +1,14 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "unit_tests/tests_configuration.h"
+
+namespace NEO {
+constexpr TestMode defaultTestMode = TestMode::UnitTests;
+} // namespace NEO
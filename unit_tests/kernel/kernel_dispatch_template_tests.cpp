@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/command_stream/linear_stream.h"
+#include "core/helpers/aligned_memory.h"
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "runtime/helpers/per_thread_data.h"
+#include "runtime/kernel/kernel_dispatch_template.h"
+#include "test.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct KernelDispatchTemplatePerThreadDataTest : public ::testing::Test {
+    void SetUp() override {
+        heapMemory = alignedMalloc(heapSize, 64);
+        memset(heapMemory, 0, heapSize);
+    }
+    void TearDown() override {
+        alignedFree(heapMemory);
+    }
+
+    KernelDispatchTemplate dispatchTemplate;
+    KernelDispatchTemplate::PerThreadDataKey key = {8, 32, 3, {{16, 2, 1}}, {{0, 1, 2}}, false};
+    static constexpr size_t heapSize = 16384;
+    void *heapMemory = nullptr;
+};
+
+TEST_F(KernelDispatchTemplatePerThreadDataTest, givenSameKeyWhenSendingPerThreadDataAgainThenRecordedLocalIdsAreCopied) {
+    LinearStream heap(heapMemory, heapSize);
+
+    auto firstOffset = dispatchTemplate.sendPerThreadData(heap, key);
+    auto firstSize = heap.getUsed() - firstOffset;
+    EXPECT_EQ(0u, dispatchTemplate.getPerThreadDataReuseCount());
+
+    auto secondOffset = dispatchTemplate.sendPerThreadData(heap, key);
+    auto secondSize = heap.getUsed() - secondOffset;
+    EXPECT_EQ(1u, dispatchTemplate.getPerThreadDataReuseCount());
+
+    EXPECT_NE(0u, firstSize);
+    EXPECT_EQ(firstSize, secondSize);
+    EXPECT_EQ(0, memcmp(ptrOffset(heapMemory, firstOffset), ptrOffset(heapMemory, secondOffset), firstSize));
+}
+
+TEST_F(KernelDispatchTemplatePerThreadDataTest, givenSameKeyWhenSendingPerThreadDataThenResultMatchesPerThreadDataHelper) {
+    LinearStream heap(heapMemory, heapSize);
+    dispatchTemplate.sendPerThreadData(heap, key);
+    auto offset = dispatchTemplate.sendPerThreadData(heap, key);
+    auto size = heap.getUsed() - offset;
+
+    const size_t localWorkSize[3] = {key.localWorkSize[0], key.localWorkSize[1], key.localWorkSize[2]};
+    auto referenceOffset = PerThreadDataHelper::sendPerThreadData(heap, key.simd, key.grfSize, key.numChannels, localWorkSize,
+                                                                  key.workgroupWalkOrder, key.hasKernelOnlyImages);
+    ASSERT_EQ(size, heap.getUsed() - referenceOffset);
+    EXPECT_EQ(0, memcmp(ptrOffset(heapMemory, offset), ptrOffset(heapMemory, referenceOffset), size));
+}
+
+TEST_F(KernelDispatchTemplatePerThreadDataTest, givenDifferentLocalWorkSizeWhenSendingPerThreadDataThenLocalIdsAreRegenerated) {
+    LinearStream heap(heapMemory, heapSize);
+    dispatchTemplate.sendPerThreadData(heap, key);
+
+    auto otherKey = key;
+    otherKey.localWorkSize = {{32, 1, 1}};
+    dispatchTemplate.sendPerThreadData(heap, otherKey);
+    EXPECT_EQ(0u, dispatchTemplate.getPerThreadDataReuseCount());
+
+    dispatchTemplate.sendPerThreadData(heap, otherKey);
+    EXPECT_EQ(1u, dispatchTemplate.getPerThreadDataReuseCount());
+}
+
+TEST(KernelDispatchTemplateInterfaceDescriptorTest, givenRecordedInterfaceDescriptorWhenRestoringWithMatchingKeyOnlyThenItIsCopied) {
+    KernelDispatchTemplate dispatchTemplate;
+    KernelDispatchTemplate::InterfaceDescriptorKey key = {0x1000, 64, 96, 4, 0, 2, 0, PreemptionMode::ThreadGroup};
+    uint8_t recorded[32];
+    uint8_t restored[32] = {};
+    memset(recorded, 0xAB, sizeof(recorded));
+
+    EXPECT_FALSE(dispatchTemplate.restoreInterfaceDescriptor(key, restored, sizeof(restored)));
+    dispatchTemplate.recordInterfaceDescriptor(key, recorded, sizeof(recorded));
+
+    auto otherKey = key;
+    otherKey.slmTotalSize = 1024;
+    EXPECT_FALSE(dispatchTemplate.restoreInterfaceDescriptor(otherKey, restored, sizeof(restored)));
+
+    EXPECT_TRUE(dispatchTemplate.restoreInterfaceDescriptor(key, restored, sizeof(restored)));
+    EXPECT_EQ(0, memcmp(recorded, restored, sizeof(recorded)));
+    EXPECT_EQ(1u, dispatchTemplate.getInterfaceDescriptorReuseCount());
+}
+
+TEST(KernelDispatchTemplateSurfaceStateHeapTest, givenRecordedSurfaceStateHeapWhenReusingInSameHeapGenerationThenBindingTablePointerIsReturned) {
+    KernelDispatchTemplate dispatchTemplate;
+    size_t bindingTablePointer = 0;
+
+    EXPECT_FALSE(dispatchTemplate.reuseSurfaceStateHeap(5, bindingTablePointer));
+    dispatchTemplate.recordSurfaceStateHeap(5, 0x140);
+
+    EXPECT_FALSE(dispatchTemplate.reuseSurfaceStateHeap(6, bindingTablePointer));
+    EXPECT_TRUE(dispatchTemplate.reuseSurfaceStateHeap(5, bindingTablePointer));
+    EXPECT_EQ(0x140u, bindingTablePointer);
+    EXPECT_EQ(1u, dispatchTemplate.getSurfaceStateHeapReuseCount());
+}
+
+TEST(KernelDispatchTemplateSurfaceStateHeapTest, givenSurfaceStateHeapMarkedDirtyWhenReusingThenFalseIsReturned) {
+    KernelDispatchTemplate dispatchTemplate;
+    size_t bindingTablePointer = 0;
+
+    dispatchTemplate.recordSurfaceStateHeap(5, 0x140);
+    dispatchTemplate.markSurfaceStateHeapDirty();
+    EXPECT_FALSE(dispatchTemplate.reuseSurfaceStateHeap(5, bindingTablePointer));
+}
+
+TEST(KernelDispatchTemplateSurfaceStateHeapTest, whenKernelSurfaceStateHeapIsAccessedForWritingThenRecordedSurfaceStatesAreInvalidated) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+    MockKernelWithInternals mockKernel(*device);
+    auto &dispatchTemplate = mockKernel.mockKernel->getDispatchTemplate();
+    size_t bindingTablePointer = 0;
+
+    dispatchTemplate.recordSurfaceStateHeap(5, 0x140);
+    static_cast<const Kernel *>(mockKernel.mockKernel)->getSurfaceStateHeap();
+    EXPECT_TRUE(dispatchTemplate.reuseSurfaceStateHeap(5, bindingTablePointer));
+
+    mockKernel.mockKernel->getSurfaceStateHeap();
+    EXPECT_FALSE(dispatchTemplate.reuseSurfaceStateHeap(5, bindingTablePointer));
+}
+
+using KernelDispatchTemplateEnqueueTest = Test<DeviceFixture>;
+
+HWTEST_F(KernelDispatchTemplateEnqueueTest, givenKernelEnqueuedTwiceWithSameGeometryThenDispatchTemplateIsReusedAndInterfaceDescriptorsMatch) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableKernelDispatchTemplates.set(true);
+
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+    size_t lws[3] = {8, 1, 1};
+    auto &dsh = cmdQ.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 8192);
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr));
+    auto firstInterfaceDescriptor = *reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(ptrOffset(dsh.getCpuBase(), dsh.getUsed() - sizeof(INTERFACE_DESCRIPTOR_DATA)));
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr));
+    auto secondInterfaceDescriptor = *reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(ptrOffset(dsh.getCpuBase(), dsh.getUsed() - sizeof(INTERFACE_DESCRIPTOR_DATA)));
+
+    auto &dispatchTemplate = mockKernel.mockKernel->getDispatchTemplate();
+    EXPECT_EQ(1u, dispatchTemplate.getPerThreadDataReuseCount());
+    EXPECT_EQ(1u, dispatchTemplate.getInterfaceDescriptorReuseCount());
+
+    firstInterfaceDescriptor.setBindingTablePointer(0);
+    secondInterfaceDescriptor.setBindingTablePointer(0);
+    EXPECT_EQ(0, memcmp(&firstInterfaceDescriptor, &secondInterfaceDescriptor, sizeof(INTERFACE_DESCRIPTOR_DATA)));
+}
+
+HWTEST_F(KernelDispatchTemplateEnqueueTest, givenKernelWithBindingTableEnqueuedTwiceWhenSurfaceStatesAreNotModifiedThenTheyAreNotPushedAgain) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableKernelDispatchTemplates.set(true);
+
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    SPatchBindingTableState bindingTableState = {};
+    bindingTableState.Count = 1;
+    mockKernel.kernelInfo.patchInfo.bindingTableState = &bindingTableState;
+    mockKernel.kernelInfo.usesSsh = true;
+    mockKernel.mockKernel->numberOfBindingTableStates = 1;
+    size_t gws[3] = {16, 1, 1};
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    auto sshUsedAfterFirstEnqueue = ssh.getUsed();
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    EXPECT_EQ(sshUsedAfterFirstEnqueue, ssh.getUsed());
+    EXPECT_EQ(1u, mockKernel.mockKernel->getDispatchTemplate().getSurfaceStateHeapReuseCount());
+
+    mockKernel.mockKernel->getSurfaceStateHeap();
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    EXPECT_LT(sshUsedAfterFirstEnqueue, ssh.getUsed());
+    EXPECT_EQ(1u, mockKernel.mockKernel->getDispatchTemplate().getSurfaceStateHeapReuseCount());
+}
+
+HWTEST_F(KernelDispatchTemplateEnqueueTest, givenDefaultSettingsWhenKernelIsEnqueuedTwiceThenNothingIsReused) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {16, 1, 1};
+
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr));
+
+    auto &dispatchTemplate = mockKernel.mockKernel->getDispatchTemplate();
+    EXPECT_EQ(0u, dispatchTemplate.getPerThreadDataReuseCount());
+    EXPECT_EQ(0u, dispatchTemplate.getInterfaceDescriptorReuseCount());
+    EXPECT_EQ(0u, dispatchTemplate.getSurfaceStateHeapReuseCount());
+}
@@ -0,0 +1,354 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Measures driver startup against DrmNullDevice: every run is a forked process that initializes
+// the platform from scratch, so nothing is cached between runs. Driver internal phases come
+// from the PlatformInitializationTimesFile debug variable, which requires a build with debug
+// variables enabled (debug, release-internal or release with regkeys); the target isn't defined otherwise.
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+using PhaseTimes = std::map<std::string, double>;
+
+struct BenchmarkConfig {
+    int devices = 1;
+    bool lazyEngines = false;
+    bool parallelInit = false;
+    int preemptionMode = -1;
+    int runs = 5;
+    bool kernel = true;
+    std::string outputFile;
+    std::string baselineFile;
+    double threshold = 10.0;
+};
+
+const char *kernelSource = "__kernel void startup(__global int *dst) { dst[get_global_id(0)] = 1; }";
+
+class PhaseTimer {
+  public:
+    PhaseTimer(PhaseTimes &times, const char *phase) : times(times), phase(phase), start(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer() {
+        times[phase] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+
+  protected:
+    PhaseTimes &times;
+    const char *phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+// parses flat "key": number pairs of the given JSON object, nested objects are skipped
+PhaseTimes parseJsonObject(const std::string &json, const std::string &objectName) {
+    PhaseTimes values;
+    size_t position = 0;
+    if (!objectName.empty()) {
+        position = json.find("\"" + objectName + "\"");
+        if (position == std::string::npos) {
+            return values;
+        }
+    }
+    position = json.find('{', position);
+    if (position == std::string::npos) {
+        return values;
+    }
+    auto end = json.find('}', position);
+    while (position < end) {
+        auto keyStart = json.find('"', position);
+        if (keyStart == std::string::npos || keyStart > end) {
+            break;
+        }
+        auto keyEnd = json.find('"', keyStart + 1);
+        auto colon = json.find(':', keyEnd);
+        if (keyEnd == std::string::npos || colon == std::string::npos || colon > end) {
+            break;
+        }
+        values[json.substr(keyStart + 1, keyEnd - keyStart - 1)] = std::strtod(json.c_str() + colon + 1, nullptr);
+        position = colon + 1;
+    }
+    return values;
+}
+
+std::string readFile(const std::string &fileName) {
+    std::ifstream file(fileName);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void setDebugVariable(const char *name, int value) {
+    setenv(name, std::to_string(value).c_str(), 1);
+}
+
+void setupDriverEnvironment(const BenchmarkConfig &config, const std::string &driverTimesFile) {
+    setDebugVariable("EnableNullHardware", 1);
+    setDebugVariable("CreateMultipleRootDevices", config.devices > 1 ? config.devices : 0);
+    setDebugVariable("LazyEngineInitialization", config.lazyEngines);
+    setDebugVariable("ParallelDeviceInitialization", config.parallelInit);
+    setDebugVariable("ForcePreemptionMode", config.preemptionMode);
+    setenv("PlatformInitializationTimesFile", driverTimesFile.c_str(), 1);
+}
+
+// Runs in a forked process. With EnableNullHardware the CSR tag reads as completed, so waits return
+// immediately. Objects are not released, teardown isn't measured and the process exits right after reporting.
+PhaseTimes runStartup(const BenchmarkConfig &config) {
+    PhaseTimes times;
+    std::string driverTimesFile = "/tmp/igdrcl_startup_benchmark_" + std::to_string(getpid()) + ".json";
+    setupDriverEnvironment(config, driverTimesFile);
+
+    cl_int retVal = CL_SUCCESS;
+    cl_platform_id platform = nullptr;
+    {
+        PhaseTimer timer(times, "clGetPlatformIDs");
+        retVal = clGetPlatformIDs(1, &platform, nullptr);
+    }
+    if (retVal != CL_SUCCESS) {
+        return {};
+    }
+    for (auto &driverTime : parseJsonObject(readFile(driverTimesFile), "")) {
+        times["driver." + driverTime.first] = driverTime.second;
+    }
+    unlink(driverTimesFile.c_str());
+
+    cl_device_id device = nullptr;
+    {
+        PhaseTimer timer(times, "clGetDeviceIDs");
+        retVal = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr);
+    }
+    cl_context context = nullptr;
+    {
+        PhaseTimer timer(times, "clCreateContext");
+        context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &retVal);
+    }
+    cl_command_queue queue = nullptr;
+    {
+        PhaseTimer timer(times, "clCreateCommandQueueWithProperties");
+        queue = clCreateCommandQueueWithProperties(context, device, nullptr, &retVal);
+    }
+    if (retVal != CL_SUCCESS) {
+        return {};
+    }
+
+    constexpr size_t bufferSize = 4096;
+    auto srcBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE, bufferSize, nullptr, &retVal);
+    auto dstBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE, bufferSize, nullptr, &retVal);
+    {
+        // first use of a builtin kernel builds the builtin dispatch info
+        PhaseTimer timer(times, "firstBuiltinEnqueue");
+        retVal = clEnqueueCopyBuffer(queue, srcBuffer, dstBuffer, 0, 0, bufferSize, 0, nullptr, nullptr);
+    }
+    {
+        PhaseTimer timer(times, "secondBuiltinEnqueue");
+        retVal = clEnqueueCopyBuffer(queue, srcBuffer, dstBuffer, 0, 0, bufferSize, 0, nullptr, nullptr);
+    }
+
+    if (config.kernel) {
+        cl_program program = nullptr;
+        {
+            PhaseTimer timer(times, "programBuild");
+            program = clCreateProgramWithSource(context, 1, &kernelSource, nullptr, &retVal);
+            if (retVal == CL_SUCCESS) {
+                retVal = clBuildProgram(program, 1, &device, nullptr, nullptr, nullptr);
+            }
+        }
+        if (retVal == CL_SUCCESS) {
+            auto kernel = clCreateKernel(program, "startup", &retVal);
+            clSetKernelArg(kernel, 0, sizeof(cl_mem), &dstBuffer);
+            size_t globalWorkSize = bufferSize / sizeof(cl_int);
+            {
+                PhaseTimer timer(times, "firstEnqueueNDRangeKernel");
+                retVal = clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &globalWorkSize, nullptr, 0, nullptr, nullptr);
+            }
+            {
+                PhaseTimer timer(times, "secondEnqueueNDRangeKernel");
+                retVal = clEnqueueNDRangeKernel(queue, kernel, 1, nullptr, &globalWorkSize, nullptr, 0, nullptr, nullptr);
+            }
+        } else {
+            // no compiler available, kernel phases are not reported
+            times.erase("programBuild");
+        }
+    }
+    clFlush(queue);
+    return times;
+}
+
+std::string serializeTimes(const PhaseTimes &times) {
+    std::stringstream json;
+    json << "{";
+    for (auto it = times.begin(); it != times.end(); ++it) {
+        json << (it == times.begin() ? "" : ", ") << "\"" << it->first << "\": " << it->second;
+    }
+    json << "}";
+    return json.str();
+}
+
+bool runInChildProcess(const BenchmarkConfig &config, PhaseTimes &times) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    auto pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        auto result = serializeTimes(runStartup(config));
+        auto written = write(fds[1], result.c_str(), result.size());
+        close(fds[1]);
+        _exit(written == static_cast<ssize_t>(result.size()) ? 0 : 1);
+    }
+    close(fds[1]);
+    std::string result;
+    char buffer[1024];
+    ssize_t readBytes = 0;
+    while ((readBytes = read(fds[0], buffer, sizeof(buffer))) > 0) {
+        result.append(buffer, readBytes);
+    }
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    times = parseJsonObject(result, "");
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 && !times.empty();
+}
+
+PhaseTimes aggregate(const std::vector<PhaseTimes> &runs, double percentile) {
+    std::map<std::string, std::vector<double>> samples;
+    for (auto &run : runs) {
+        for (auto &phase : run) {
+            samples[phase.first].push_back(phase.second);
+        }
+    }
+    PhaseTimes result;
+    for (auto &phase : samples) {
+        auto &values = phase.second;
+        std::sort(values.begin(), values.end());
+        result[phase.first] = values[static_cast<size_t>(percentile * (values.size() - 1) + 0.5)];
+    }
+    return result;
+}
+
+std::string createReport(const BenchmarkConfig &config, const std::vector<PhaseTimes> &runs) {
+    std::stringstream json;
+    json << "{\n"
+         << "  \"config\": {\"devices\": " << config.devices << ", \"lazyEngines\": " << config.lazyEngines
+         << ", \"parallelInit\": " << config.parallelInit << ", \"preemptionMode\": " << config.preemptionMode
+         << ", \"runs\": " << runs.size() << "},\n"
+         << "  \"medianUs\": " << serializeTimes(aggregate(runs, 0.5)) << ",\n"
+         << "  \"minUs\": " << serializeTimes(aggregate(runs, 0.0)) << ",\n"
+         << "  \"maxUs\": " << serializeTimes(aggregate(runs, 1.0)) << "\n"
+         << "}\n";
+    return json.str();
+}
+
+// returns number of phases slower than baseline by more than threshold percent
+int compareWithBaseline(const std::string &report, const BenchmarkConfig &config) {
+    auto baseline = parseJsonObject(readFile(config.baselineFile), "medianUs");
+    auto current = parseJsonObject(report, "medianUs");
+    int regressions = 0;
+    for (auto &phase : current) {
+        auto reference = baseline.find(phase.first);
+        if (reference == baseline.end() || reference->second <= 0.0) {
+            continue;
+        }
+        auto change = 100.0 * (phase.second - reference->second) / reference->second;
+        if (change > config.threshold) {
+            fprintf(stderr, "REGRESSION %s: %.1f us -> %.1f us (+%.1f%%)\n", phase.first.c_str(), reference->second, phase.second, change);
+            regressions++;
+        }
+    }
+    return regressions;
+}
+
+void printUsage(const char *name) {
+    printf("Usage: %s [options]\n"
+           "  --devices N       number of root devices to create (CreateMultipleRootDevices)\n"
+           "  --lazy-engines    create non default engines on first use (LazyEngineInitialization)\n"
+           "  --parallel-init   create devices and engine allocations concurrently (ParallelDeviceInitialization)\n"
+           "  --preemption N    force preemption mode, 4 (MidThread) includes SIP kernel creation (ForcePreemptionMode)\n"
+           "  --runs N          number of measured process starts, default 5\n"
+           "  --no-kernel       skip program build and first kernel enqueue\n"
+           "  --output FILE     write JSON report to FILE instead of stdout\n"
+           "  --baseline FILE   compare medians with a previous report, exit with 1 on regression\n"
+           "  --threshold PCT   allowed slowdown against baseline in percent, default 10\n",
+           name);
+}
+
+bool parseArguments(int argc, char **argv, BenchmarkConfig &config) {
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (argument == "--devices" && hasValue) {
+            config.devices = std::max(1, atoi(argv[++i]));
+        } else if (argument == "--lazy-engines") {
+            config.lazyEngines = true;
+        } else if (argument == "--parallel-init") {
+            config.parallelInit = true;
+        } else if (argument == "--preemption" && hasValue) {
+            config.preemptionMode = atoi(argv[++i]);
+        } else if (argument == "--runs" && hasValue) {
+            config.runs = std::max(1, atoi(argv[++i]));
+        } else if (argument == "--no-kernel") {
+            config.kernel = false;
+        } else if (argument == "--output" && hasValue) {
+            config.outputFile = argv[++i];
+        } else if (argument == "--baseline" && hasValue) {
+            config.baselineFile = argv[++i];
+        } else if (argument == "--threshold" && hasValue) {
+            config.threshold = atof(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, char **argv) {
+    BenchmarkConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<PhaseTimes> runs;
+    for (int run = 0; run < config.runs; run++) {
+        PhaseTimes times;
+        if (!runInChildProcess(config, times)) {
+            fprintf(stderr, "Startup run %d failed\n", run);
+            return 2;
+        }
+        runs.push_back(times);
+    }
+
+    auto report = createReport(config, runs);
+    if (config.outputFile.empty()) {
+        printf("%s", report.c_str());
+    } else {
+        std::ofstream(config.outputFile) << report;
+    }
+
+    if (!config.baselineFile.empty() && compareWithBaseline(report, config) > 0) {
+        return 1;
+    }
+    return 0;
+}
@@ -11,8 +11,31 @@
 
 #include "gtest/gtest.h"
 
+#include <limits>
+#include <vector>
+
 using namespace NEO;
 
+struct SizedDeferrableDeletion : public DeferrableDeletion {
+    SizedDeferrableDeletion(size_t size, std::vector<size_t> &appliedSizes, int notReadyCount = 0)
+        : size(size), appliedSizes(appliedSizes), notReadyCount(notReadyCount) {}
+
+    bool apply() override {
+        if (notReadyCount > 0) {
+            notReadyCount--;
+            return false;
+        }
+        appliedSizes.push_back(size);
+        return true;
+    }
+
+    size_t getSize() const override { return size; }
+
+    size_t size;
+    std::vector<size_t> &appliedSizes;
+    int notReadyCount;
+};
+
 TEST(DeferredDeleter, NonCopyable) {
     EXPECT_FALSE(std::is_move_constructible<DeferredDeleter>::value);
     EXPECT_FALSE(std::is_copy_constructible<DeferredDeleter>::value);
@@ -234,3 +257,83 @@ TEST_F(DeferredDeleterTest, givenDeferredDeleterWhenNonBlockingDrainIsCalledThen
     EXPECT_EQ(0, deleter->areElementsReleasedCalled);
     EXPECT_EQ(1, deleter->drainCalled);
 }
+
+TEST_F(DeferredDeleterTest, givenLargeAndSmallDeletionsWhenDrainIsCalledThenLargeDeletionsAreAppliedFirst) {
+    std::vector<size_t> appliedSizes;
+    constexpr size_t smallSize = MemoryConstants::pageSize;
+    constexpr size_t largeSize = DeferredDeleter::highPriorityDeletionSize;
+
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(smallSize, appliedSizes));
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(largeSize, appliedSizes));
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(smallSize + 1, appliedSizes));
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(largeSize + 1, appliedSizes));
+
+    deleter->drain(false);
+
+    std::vector<size_t> expectedSizes = {largeSize, largeSize + 1, smallSize, smallSize + 1};
+    EXPECT_EQ(expectedSizes, appliedSizes);
+}
+
+TEST_F(DeferredDeleterTest, givenPendingDeletionsWhenDrainUntilIsCalledThenOnlyRequestedAmountIsReleased) {
+    std::vector<size_t> appliedSizes;
+    constexpr size_t size = MemoryConstants::megaByte;
+    for (int i = 0; i < 4; i++) {
+        deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(size, appliedSizes));
+    }
+
+    EXPECT_EQ(2 * size, deleter->drainUntil(2 * size - 1));
+    EXPECT_EQ(2u, appliedSizes.size());
+    EXPECT_EQ(2, deleter->getElementsToRelease());
+    EXPECT_FALSE(deleter->isQueueEmpty());
+
+    EXPECT_EQ(0u, deleter->drainUntil(0));
+    EXPECT_EQ(2 * size, deleter->drainUntil(16 * size));
+    EXPECT_EQ(4u, appliedSizes.size());
+    EXPECT_TRUE(deleter->isQueueEmpty());
+}
+
+TEST_F(DeferredDeleterTest, givenDeletionNotReadyWhenDrainUntilIsCalledThenItIsNotWaitedForAndStaysQueued) {
+    std::vector<size_t> appliedSizes;
+    constexpr size_t size = DeferredDeleter::highPriorityDeletionSize;
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(size, appliedSizes, 1));
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(MemoryConstants::pageSize, appliedSizes));
+
+    EXPECT_EQ(MemoryConstants::pageSize, deleter->drainUntil(size));
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+    EXPECT_FALSE(deleter->isQueueEmpty());
+
+    EXPECT_EQ(size, deleter->drainUntil(size));
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+    EXPECT_TRUE(deleter->isQueueEmpty());
+}
+
+TEST_F(DeferredDeleterTest, givenDeletionsNotReadyWhenDrainUntilIsCalledThenTheyStayQueuedInOrder) {
+    std::vector<size_t> appliedSizes;
+    constexpr size_t size = MemoryConstants::pageSize;
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(size, appliedSizes, 1));
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(size + 1, appliedSizes));
+    deleter->DeferredDeleter::deferDeletion(new SizedDeferrableDeletion(size + 2, appliedSizes, 1));
+
+    EXPECT_EQ(size + 1, deleter->drainUntil(std::numeric_limits<size_t>::max()));
+    EXPECT_EQ(2, deleter->getElementsToRelease());
+
+    deleter->drain(false);
+    std::vector<size_t> expectedSizes = {size + 1, size, size + 2};
+    EXPECT_EQ(expectedSizes, appliedSizes);
+}
+
+TEST_F(DeferredDeleterTest, givenOtherThreadRetryingDeletionsWhenClearQueueFindsOnlyDeletionsNotReadyThenItReturnsWithoutRetrying) {
+    std::vector<size_t> appliedSizes;
+    auto deletion = new SizedDeferrableDeletion(MemoryConstants::pageSize, appliedSizes, 1);
+    deleter->DeferredDeleter::deferDeletion(deletion);
+
+    deleter->setRetryingThreadActive(true);
+    deleter->clearQueue();
+    EXPECT_EQ(0, deletion->notReadyCount);
+    EXPECT_TRUE(appliedSizes.empty());
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+
+    deleter->setRetryingThreadActive(false);
+    deleter->drain(false);
+    EXPECT_EQ(1u, appliedSizes.size());
+}
@@ -124,3 +124,32 @@ TEST(GfxPartitionTest, testGfxPartitionUnsupportedRange) {
     MockGfxPartition gfxPartition;
     EXPECT_THROW(gfxPartition.init(maxNBitValue(48 + 1), reservedCpuAddressRangeSize, 0), std::exception);
 }
+
+TEST(GfxPartitionTest, givenHeapWithFreedRangesWhenGettingHeapFragmentationThenFreedRangesAreReported) {
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0);
+
+    auto heap = HeapIndex::HEAP_STANDARD;
+    auto heapAvailableSize = gfxPartition.getHeapSize(heap) - 2 * GfxPartition::heapGranularity;
+    EXPECT_EQ(heapAvailableSize, gfxPartition.getHeapFragmentation(heap).availableSize);
+
+    size_t sizes[3] = {MemoryConstants::pageSize, MemoryConstants::pageSize, MemoryConstants::pageSize};
+    uint64_t ptrs[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        ptrs[i] = gfxPartition.heapAllocate(heap, sizes[i]);
+        EXPECT_NE(0ull, ptrs[i]);
+    }
+    gfxPartition.heapFree(heap, ptrs[0], sizes[0]);
+
+    auto fragmentation = gfxPartition.getHeapFragmentation(heap);
+    EXPECT_EQ(1u, fragmentation.freedChunksCount);
+    EXPECT_EQ(MemoryConstants::pageSize, fragmentation.freedChunksSize);
+    EXPECT_EQ(heapAvailableSize - 2 * MemoryConstants::pageSize, fragmentation.availableSize);
+
+    gfxPartition.heapFree(heap, ptrs[1], sizes[1]);
+    gfxPartition.heapFree(heap, ptrs[2], sizes[2]);
+
+    fragmentation = gfxPartition.getHeapFragmentation(heap);
+    EXPECT_EQ(0u, fragmentation.freedChunksCount);
+    EXPECT_EQ(heapAvailableSize, fragmentation.largestFreeBlockSize);
+}
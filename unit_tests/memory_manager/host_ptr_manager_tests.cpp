@@ -857,7 +857,7 @@ HWTEST_F(HostPtrAllocationTest, givenOverlappingFragmentsWhenCheckIsCalledThenWa
     uint32_t taskCountReady = 2;
     uint32_t taskCountNotReady = 1;
 
-    auto &engines = memoryManager->getRegisteredEngines();
+    auto engines = memoryManager->getRegisteredEngines();
     EXPECT_EQ(1u, engines.size());
 
     auto csr0 = static_cast<MockCommandStreamReceiver *>(engines[0].commandStreamReceiver);
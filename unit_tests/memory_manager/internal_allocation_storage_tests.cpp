@@ -7,6 +7,7 @@
 
 #include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "core/unit_tests/utilities/containers_tests_helpers.h"
+#include "runtime/event/event.h"
 #include "runtime/memory_manager/internal_allocation_storage.h"
 #include "runtime/os_interface/os_context.h"
 #include "test.h"
@@ -193,6 +194,160 @@ TEST_F(InternalAllocationStorageTest, givenAllocationWhenItIsPutOnReusableListWh
     EXPECT_EQ(nullptr, internalAllocation);
 }
 
+TEST_F(InternalAllocationStorageTest, givenMultipleReusableAllocationsWhenObtainingAllocationThenSmallestFittingOneIsReturned) {
+    auto largeAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 16 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto mediumAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 4 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    *csr->getTagAddress() = 0u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(largeAllocation), REUSABLE_ALLOCATION, 0u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 0u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(mediumAllocation), REUSABLE_ALLOCATION, 0u);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(2 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(mediumAllocation, reusedAllocation.get());
+
+    auto &statistics = storage->peekReuseStatistics();
+    EXPECT_EQ(1u, statistics.hits.load());
+    EXPECT_EQ(0u, statistics.misses.load());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, statistics.bytesWasted.load());
+
+    auto reusedAllocation2 = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation2.get());
+
+    auto notReusedAllocation = storage->obtainReusableAllocation(32 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(nullptr, notReusedAllocation);
+
+    EXPECT_EQ(2u, statistics.hits.load());
+    EXPECT_EQ(1u, statistics.misses.load());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, statistics.bytesWasted.load());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(reusedAllocation2.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsMovedOutAndBackToListWhenObtainingAllocationThenSizeClassesFollowTheList) {
+    auto largeAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, 16 * MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    *csr->getTagAddress() = 0u;
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(largeAllocation), REUSABLE_ALLOCATION, 0u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 0u);
+    EXPECT_EQ(17 * MemoryConstants::pageSize, reusableAllocations.peekTotalSize());
+
+    auto detachedAllocations = reusableAllocations.detachNodes();
+    EXPECT_EQ(0u, reusableAllocations.peekTotalSize());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER));
+
+    reusableAllocations.splice(*detachedAllocations);
+    EXPECT_EQ(17 * MemoryConstants::pageSize, reusableAllocations.peekTotalSize());
+
+    auto removedAllocation = reusableAllocations.removeOne(*smallAllocation);
+    EXPECT_EQ(16 * MemoryConstants::pageSize, reusableAllocations.peekTotalSize());
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(largeAllocation, reusedAllocation.get());
+    EXPECT_EQ(0u, reusableAllocations.peekTotalSize());
+    EXPECT_TRUE(reusableAllocations.peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(removedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsBudgetWhenStoringAllocationsAboveBudgetThenOldestCompletedAllocationsAreReleased) {
+    DebugManagerStateRestore stateRestorer;
+    DebugManager.flags.ReusableAllocationsBudgetInKB.set(static_cast<int32_t>(2 * MemoryConstants::pageSize / MemoryConstants::kiloByte));
+    *csr->getTagAddress() = 1u;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto allocation3 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto allocation4 = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation3), REUSABLE_ALLOCATION, 1u);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+    EXPECT_FALSE(csr->getAllocationsForReuse().peekContains(*allocation2));
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation3));
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation4), REUSABLE_ALLOCATION, 1u);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation));
+    EXPECT_FALSE(csr->getAllocationsForReuse().peekContains(*allocation3));
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation4));
+    EXPECT_EQ(-1, verifyDListOrder(csr->getAllocationsForReuse().peekHead(), allocation, allocation4));
+    EXPECT_EQ(2 * MemoryConstants::pageSize, storage->peekReuseStatistics().bytesTrimmed.load());
+
+    storage->cleanAllocationList(5u, REUSABLE_ALLOCATION);
+}
+
+TEST_F(InternalAllocationStorageTest, givenStoredHostPtrAllocationWhenObtainingForSamePointerThenItIsReturnedOnlyIfLargeEnough) {
+    auto contextId = csr->getOsContext().getContextId();
+    auto hostPtr = reinterpret_cast<void *>(0x10000);
+    auto allocation = new MockGraphicsAllocation(hostPtr, MemoryConstants::pageSize);
+    allocation->updateTaskCount(1u, contextId);
+
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(allocation), 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(1u, storage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
+
+    EXPECT_EQ(nullptr, storage->obtainHostPtrAllocation(ptrOffset(hostPtr, 4), 4));
+    EXPECT_EQ(nullptr, storage->obtainHostPtrAllocation(hostPtr, MemoryConstants::pageSize + 1));
+    EXPECT_EQ(allocation, storage->obtainHostPtrAllocation(hostPtr, MemoryConstants::pageSize / 2));
+    EXPECT_EQ(Event::eventNotReady, allocation->getTaskCount(contextId));
+    EXPECT_EQ(1u, storage->peekReuseStatistics().hostPtrHits.load());
+    EXPECT_EQ(2u, storage->peekReuseStatistics().hostPtrMisses.load());
+
+    storage->releaseHostPtrAllocations();
+    EXPECT_EQ(0u, storage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation));
+    storage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
+}
+
+TEST_F(InternalAllocationStorageTest, givenStoredHostPtrAllocationWhenOverlappingOneIsStoredOrRangeIsReleasedThenOverlappedAllocationsAreMovedToTemporaryList) {
+    uintptr_t hostPtr = 0x10000;
+    auto allocation = new MockGraphicsAllocation(reinterpret_cast<void *>(hostPtr), 2 * MemoryConstants::pageSize);
+    auto overlappingAllocation = new MockGraphicsAllocation(reinterpret_cast<void *>(hostPtr + MemoryConstants::pageSize), 2 * MemoryConstants::pageSize);
+    auto adjacentAllocation = new MockGraphicsAllocation(reinterpret_cast<void *>(hostPtr + 3 * MemoryConstants::pageSize), MemoryConstants::pageSize);
+
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(allocation), 8 * MemoryConstants::pageSize);
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(overlappingAllocation), 8 * MemoryConstants::pageSize);
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(adjacentAllocation), 8 * MemoryConstants::pageSize);
+    EXPECT_EQ(2u, storage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation));
+
+    storage->releaseHostPtrAllocations(reinterpret_cast<void *>(hostPtr + 2 * MemoryConstants::pageSize + 4), 4);
+    EXPECT_EQ(1u, storage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*overlappingAllocation));
+    EXPECT_FALSE(csr->getTemporaryAllocations().peekContains(*adjacentAllocation));
+
+    storage->releaseHostPtrAllocations();
+    storage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
+}
+
+TEST_F(InternalAllocationStorageTest, givenHostPtrAllocationsAboveBudgetWhenStoringThenLeastRecentlyUsedOnesAreMovedToTemporaryList) {
+    auto allocation = new MockGraphicsAllocation(reinterpret_cast<void *>(0x10000), MemoryConstants::pageSize);
+    auto allocation2 = new MockGraphicsAllocation(reinterpret_cast<void *>(0x20000), MemoryConstants::pageSize);
+    auto allocation3 = new MockGraphicsAllocation(reinterpret_cast<void *>(0x30000), MemoryConstants::pageSize);
+    auto tooBigAllocation = new MockGraphicsAllocation(reinterpret_cast<void *>(0x40000), 4 * MemoryConstants::pageSize);
+
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(allocation), 2 * MemoryConstants::pageSize);
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(allocation2), 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(allocation, storage->obtainHostPtrAllocation(allocation->getUnderlyingBuffer(), MemoryConstants::pageSize));
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(allocation3), 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(2u, storage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation2));
+    EXPECT_FALSE(csr->getTemporaryAllocations().peekContains(*allocation));
+
+    storage->storeHostPtrAllocation(std::unique_ptr<GraphicsAllocation>(tooBigAllocation), 2 * MemoryConstants::pageSize);
+    EXPECT_EQ(2u, storage->getHostPtrAllocationsCount());
+    EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*tooBigAllocation));
+
+    storage->releaseHostPtrAllocations();
+    storage->cleanAllocationList(-1, TEMPORARY_ALLOCATION);
+}
+
 class WaitAtDeletionAllocation : public MockGraphicsAllocation {
   public:
     WaitAtDeletionAllocation(void *buffer, size_t sizeIn)
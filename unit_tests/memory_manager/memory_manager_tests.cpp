@@ -1666,6 +1666,24 @@ TEST(MemoryManagerRegisteredEnginesTest, givenOsContextWhenItIsUnregisteredFromM
     engine.osContext->decRefInternal();
 }
 
+TEST(MemoryManagerRegisteredEnginesTest, givenRootDeviceCreatedThenItsDefaultEngineIsMemoryManagerDefaultUntilUnregistered) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+    auto memoryManager = device->getMemoryManager();
+    auto &engine = device->getDefaultEngine();
+    EXPECT_EQ(engine.osContext, memoryManager->getDefaultEngineContext());
+
+    ASSERT_LT(1u, device->engines.size());
+    auto otherEngine = (&device->engines[0] == &engine) ? device->engines[1] : device->engines[0];
+    memoryManager->setDefaultEngineContext(otherEngine.osContext);
+    EXPECT_EQ(engine.osContext, memoryManager->getDefaultEngineContext());
+
+    engine.osContext->incRefInternal();
+    memoryManager->unregisterEngineForCsr(engine.commandStreamReceiver);
+    EXPECT_NE(engine.osContext, memoryManager->getDefaultEngineContext());
+    EXPECT_EQ(memoryManager->getRegisteredEngines()[0].osContext, memoryManager->getDefaultEngineContext());
+    engine.osContext->decRefInternal();
+}
+
 TEST(ResidencyDataTest, givenDeviceBitfieldWhenCreatingOsContextThenSetValidValue) {
     MockExecutionEnvironment executionEnvironment(*platformDevices);
     MockMemoryManager memoryManager(false, false, executionEnvironment);
@@ -25,6 +25,10 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::allowAsyncProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::callbackWorkers;
+    using AsyncEventsHandler::closeCallbackWorkers;
+    using AsyncEventsHandler::completionHeaps;
+    using AsyncEventsHandler::openCallbackWorkers;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
 
@@ -59,7 +63,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && completionHeaps.size() == 0; }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
@@ -22,11 +22,11 @@ class MockBuiltinDispatchInfoBuilder : public BuiltinDispatchInfoBuilder {
     bool buildDispatchInfos(MultiDispatchInfo &mdi, const BuiltinOpParams &conf) const override {
         validateInput(conf);
         builtinOpParams = conf;
-        originalBuilder->buildDispatchInfos(mdi, conf);
+        auto result = originalBuilder->buildDispatchInfos(mdi, conf);
         for (auto &di : mdi) {
             multiDispatchInfo.push(di);
         }
-        return true;
+        return result;
     }
 
     const BuiltinOpParams *getBuiltinOpParams() const {
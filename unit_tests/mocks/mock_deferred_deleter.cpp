@@ -78,7 +78,7 @@ bool MockDeferredDeleter::isThreadRunning() {
 
 bool MockDeferredDeleter::isQueueEmpty() {
     std::lock_guard<std::mutex> lock(queueMutex);
-    return queue.peekIsEmpty();
+    return arePendingDeletionsEmpty();
 }
 
 void MockDeferredDeleter::setElementsToRelease(int elementsNum) {
@@ -89,6 +89,10 @@ void MockDeferredDeleter::setDoWorkInBackgroundValue(bool value) {
     doWorkInBackground = value;
 }
 
+void MockDeferredDeleter::setRetryingThreadActive(bool value) {
+    retryingThreadActive = value;
+}
+
 bool MockDeferredDeleter::baseAreElementsReleased() {
     return DeferredDeleter::areElementsReleased();
 }
@@ -43,6 +43,8 @@ class MockDeferredDeleter : public DeferredDeleter {
 
     void setDoWorkInBackgroundValue(bool value);
 
+    void setRetryingThreadActive(bool value);
+
     bool baseAreElementsReleased();
 
     bool baseShouldStop();
@@ -78,12 +78,8 @@ void MockDevice::resetCommandStreamReceiver(CommandStreamReceiver *newCsr, uint3
 
     auto osContext = this->engines[engineIndex].osContext;
     auto memoryManager = executionEnvironment->memoryManager.get();
-    auto registeredEngine = *memoryManager->getRegisteredEngineForCsr(engines[engineIndex].commandStreamReceiver);
-
-    registeredEngine.commandStreamReceiver = newCsr;
     engines[engineIndex].commandStreamReceiver = newCsr;
-    memoryManager->getRegisteredEngines().emplace_back(registeredEngine);
-    osContext->incRefInternal();
+    memoryManager->registerEngineForCsr(newCsr, osContext);
     newCsr->setupContext(*osContext);
     commandStreamReceivers[engineIndex].reset(newCsr);
     commandStreamReceivers[engineIndex]->initializeTagAllocation();
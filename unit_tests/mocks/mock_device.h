@@ -39,6 +39,7 @@ class MockDevice : public RootDevice {
     using Device::engines;
     using Device::executionEnvironment;
     using Device::initializeCaps;
+    using Device::lazyEngines;
     using Device::name;
     using Device::simultaneousInterops;
     using RootDevice::createEngines;
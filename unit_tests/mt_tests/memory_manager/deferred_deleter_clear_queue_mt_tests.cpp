@@ -5,6 +5,7 @@
  *
  */
 
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/mocks/mock_deferrable_deletion.h"
 #include "unit_tests/mocks/mock_deferred_deleter.h"
 
@@ -73,7 +74,7 @@ class MyDeferredDeleter : public DeferredDeleter {
   public:
     bool isQueueEmpty() {
         std::lock_guard<std::mutex> lock(queueMutex);
-        return queue.peekIsEmpty();
+        return arePendingDeletionsEmpty();
     }
     int getElementsToRelease() {
         return elementsToRelease;
@@ -84,6 +85,9 @@ class MyDeferredDeleter : public DeferredDeleter {
     bool isThreadRunning() {
         return worker != nullptr;
     }
+    size_t getAdditionalWorkersNum() {
+        return additionalWorkers.size();
+    }
     int getClientsNum() {
         return numClients;
     }
@@ -134,3 +138,21 @@ TEST_F(DeferredDeleterMtTest, asyncThreadsStopDeferredDeleter) {
     deleter->removeClient();
     EXPECT_EQ(0, deleter->getClientsNum());
 }
+
+TEST_F(DeferredDeleterMtTest, givenMultipleWorkersWhenDeletionsAreDeferredThenAllAreAppliedBeforeStop) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DeferredDeleterWorkersCount.set(3);
+
+    deleter->addClient();
+    EXPECT_TRUE(deleter->isThreadRunning());
+    EXPECT_EQ(2u, deleter->getAdditionalWorkersNum());
+
+    for (int i = 0; i < 100; i++) {
+        deleter->deferDeletion(new MockDeferrableDeletion());
+    }
+
+    deleter->removeClient();
+    EXPECT_FALSE(deleter->isThreadRunning());
+    EXPECT_EQ(0u, deleter->getAdditionalWorkersNum());
+    EXPECT_TRUE(deleter->isQueueEmpty());
+}
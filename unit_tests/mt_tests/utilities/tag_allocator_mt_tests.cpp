@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/mocks/mock_execution_environment.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MtTimeStamps {
+    void initialize() {
+        start = 1;
+        end = 2;
+    }
+    static GraphicsAllocation::AllocationType getAllocationType() {
+        return GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER;
+    }
+    bool isCompleted() const { return true; }
+    uint64_t start;
+    uint64_t end;
+};
+
+template <typename TagType>
+class MtTagAllocator : public TagAllocator<TagType> {
+  public:
+    using BaseClass = TagAllocator<TagType>;
+    using BaseClass::BaseClass;
+    using BaseClass::deferredTags;
+    using BaseClass::flushThreadCaches;
+    using BaseClass::freeTags;
+    using BaseClass::gfxAllocations;
+    using BaseClass::usedTags;
+};
+
+struct TagAllocatorMtTest : public ::testing::TestWithParam<uint32_t /*thread count*/> {
+    static constexpr size_t tagCount = 64;
+    static constexpr uint32_t iterationsPerThread = 2000;
+};
+
+TEST_P(TagAllocatorMtTest, givenMultipleThreadsWhenTagsAreTakenAndReturnedConcurrentlyThenEachTagIsOwnedByOneThreadAtATime) {
+    MockExecutionEnvironment executionEnvironment(*platformDevices);
+    MockMemoryManager memoryManager(executionEnvironment);
+    MtTagAllocator<MtTimeStamps> tagAllocator(0, &memoryManager, tagCount, MemoryConstants::cacheLineSize, sizeof(MtTimeStamps), false);
+
+    const auto threadCount = GetParam();
+    std::atomic<bool> start{false};
+    std::atomic<uint32_t> ownershipViolations{0};
+    std::vector<std::thread> threads;
+
+    for (uint32_t threadId = 0; threadId < threadCount; threadId++) {
+        threads.emplace_back([&, threadId] {
+            while (!start) {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0; i < iterationsPerThread; i++) {
+                auto node = tagAllocator.getTag();
+                node->tagForCpuAccess->start = threadId;
+                node->tagForCpuAccess->end = i;
+                if (node->tagForCpuAccess->start != threadId || node->tagForCpuAccess->end != i) {
+                    ownershipViolations++;
+                }
+                node->returnTag();
+            }
+        });
+    }
+
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, ownershipViolations);
+    EXPECT_TRUE(tagAllocator.usedTags.peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+
+    tagAllocator.flushThreadCaches();
+    size_t freeTagsCount = 0;
+    for (auto node = tagAllocator.freeTags.peekHead(); node != nullptr; node = node->next) {
+        freeTagsCount++;
+    }
+    EXPECT_EQ(tagCount * tagAllocator.gfxAllocations.size(), freeTagsCount);
+}
+
+INSTANTIATE_TEST_CASE_P(TagAllocatorContention,
+                        TagAllocatorMtTest,
+                        ::testing::Values(1u, 4u, 16u, 64u));
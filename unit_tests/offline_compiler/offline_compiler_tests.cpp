@@ -224,6 +224,73 @@ TEST_F(MultiCommandTests, GoodMultiBuildTestWithOutputFileListFlag) {
     deleteOutFileList();
     delete pMultiCommand;
 }
+TEST_F(MultiCommandTests, GivenParallelOptionWhenBuildingMultipleFilesThenAllBuildsSucceedAndOutputFileListKeepsBuildsOrder) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-parallel",
+        "3",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 6;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal);
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+
+    std::ifstream outFileListStream(outFileList);
+    std::string line;
+    int buildNumber = 0;
+    while (std::getline(outFileListStream, line)) {
+        EXPECT_NE(std::string::npos, line.find("build_no_" + std::to_string(++buildNumber) + ".bin")) << line;
+    }
+    EXPECT_EQ(numOfBuild, buildNumber);
+    outFileListStream.close();
+
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bc") || compilerOutputExists(outFileName, "spv"));
+        EXPECT_TRUE(compilerOutputExists(outFileName, "gen"));
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+    }
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+TEST_F(MultiCommandTests, GivenParallelOptionWithoutValidNumberWhenCreatingMultiCommandThenInvalidCommandLineIsReturned) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    for (auto parallelValue : {"", "two", "-1"}) {
+        std::vector<std::string> argv = {
+            "ocloc",
+            "-multi",
+            nameOfFileWithArgs.c_str(),
+            "-parallel",
+            parallelValue};
+
+        testing::internal::CaptureStdout();
+        auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal));
+        std::string output = testing::internal::GetCapturedStdout();
+
+        EXPECT_STRNE(output.c_str(), "");
+        EXPECT_EQ(nullptr, pMultiCommand);
+        EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+    }
+}
 TEST_F(OfflineCompilerTests, GoodArgTest) {
     std::vector<std::string> argv = {
         "ocloc",
@@ -462,6 +529,26 @@ TEST_F(OfflineCompilerTests, NaughtyArgTest_Flag) {
     delete pOfflineCompiler;
 }
 
+TEST_F(OfflineCompilerTests, givenMessagesOutputWhenCreatingWithInvalidOptionThenMessageIsAppendedInsteadOfPrinted) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-n",
+        "test_files/ImANaughtyFile.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+    std::string messages;
+
+    testing::internal::CaptureStdout();
+    pOfflineCompiler = OfflineCompiler::create(argv.size(), argv, retVal, &messages);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("", output.c_str());
+    EXPECT_NE(std::string::npos, messages.find("Invalid option"));
+    EXPECT_EQ(nullptr, pOfflineCompiler);
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+
+    delete pOfflineCompiler;
+}
+
 TEST_F(OfflineCompilerTests, NaughtyArgTest_NumArgs) {
     std::vector<std::string> argvA = {
         "ocloc",
@@ -84,6 +84,7 @@ class DrmMockCustom : public Drm {
             gemMmap = 0;
             gemSetDomain = 0;
             gemWait = 0;
+            gemBusy = 0;
             gemClose = 0;
             regRead = 0;
             getParam = 0;
@@ -103,6 +104,7 @@ class DrmMockCustom : public Drm {
         std::atomic<int32_t> gemMmap;
         std::atomic<int32_t> gemSetDomain;
         std::atomic<int32_t> gemWait;
+        std::atomic<int32_t> gemBusy;
         std::atomic<int32_t> gemClose;
         std::atomic<int32_t> regRead;
         std::atomic<int32_t> getParam;
@@ -134,6 +136,7 @@ class DrmMockCustom : public Drm {
         NEO_IOCTL_EXPECT_EQ(gemMmap);
         NEO_IOCTL_EXPECT_EQ(gemSetDomain);
         NEO_IOCTL_EXPECT_EQ(gemWait);
+        NEO_IOCTL_EXPECT_EQ(gemBusy);
         NEO_IOCTL_EXPECT_EQ(gemClose);
         NEO_IOCTL_EXPECT_EQ(regRead);
         NEO_IOCTL_EXPECT_EQ(getParam);
@@ -259,6 +262,10 @@ class DrmMockCustom : public Drm {
             ioctl_cnt.gemWait++;
             break;
 
+        case DRM_IOCTL_I915_GEM_BUSY:
+            ioctl_cnt.gemBusy++;
+            break;
+
         case DRM_IOCTL_GEM_CLOSE:
             ioctl_cnt.gemClose++;
             break;
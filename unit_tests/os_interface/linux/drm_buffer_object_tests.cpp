@@ -100,6 +100,19 @@ TEST_F(DrmBufferObjectTest, setTiling_ioctlFailed) {
     EXPECT_FALSE(ret);
 }
 
+TEST_F(DrmBufferObjectTest, givenIdleBufferObjectWhenCheckingIfBusyThenFalseIsReturned) {
+    mock->ioctl_expected.total = 1; //gem_busy
+    mock->ioctl_expected.gemBusy = 1;
+    EXPECT_FALSE(bo->isBusy());
+}
+
+TEST_F(DrmBufferObjectTest, givenBusyIoctlFailedWhenCheckingIfBusyThenTrueIsReturned) {
+    mock->ioctl_expected.total = 1; //gem_busy
+    mock->ioctl_expected.gemBusy = 1;
+    mock->ioctl_res = -1;
+    EXPECT_TRUE(bo->isBusy());
+}
+
 TEST_F(DrmBufferObjectTest, givenAddressThatWhenSizeIsAddedCrosses32BitBoundaryWhenExecIsCalledThen48BitFlagIsSet) {
     drm_i915_gem_exec_object2 execObject;
 
@@ -149,4 +149,10 @@ class DrmCommandStreamEnhancedTest : public ::testing::Test {
     MockBufferObject *createBO(size_t size) {
         return new MockBufferObject(this->mock.get(), size);
     }
+
+    MockBufferObject *createReusableBO(size_t size) {
+        auto bo = createBO(size);
+        bo->isReused = true;
+        return bo;
+    }
 };
@@ -555,6 +555,54 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenTaskThatRequiresLargeResou
     EXPECT_EQ(11u, execStorage.size());
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenSameResidencyInConsecutiveFlushesWhenFlushIsCalledThenExecObjectsAreReused) {
+    std::vector<GraphicsAllocation *> graphicsAllocations;
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+
+    for (auto id = 0; id < 10; id++) {
+        graphicsAllocations.push_back(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
+    }
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs};
+
+    for (auto graphicsAllocation : graphicsAllocations) {
+        csr->makeResident(*graphicsAllocation);
+    }
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(11u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(11u, testedCsr->peekExecObjectsFilledCount());
+    EXPECT_EQ(0u, testedCsr->peekExecObjectsReusedCount());
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(11u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(11u, testedCsr->peekExecObjectsFilledCount());
+    EXPECT_EQ(11u, testedCsr->peekExecObjectsReusedCount());
+
+    auto &execStorage = testedCsr->getExecStorage();
+    for (auto id = 0u; id < graphicsAllocations.size(); id++) {
+        auto bo = static_cast<DrmAllocation *>(graphicsAllocations[id])->getBO();
+        EXPECT_EQ(static_cast<uint32_t>(bo->peekHandle()), execStorage[id].handle);
+        EXPECT_EQ(bo->peekAddress(), execStorage[id].offset);
+    }
+
+    csr->getResidencyAllocations().clear();
+    csr->makeResident(*graphicsAllocations[1]);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(2u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(13u, testedCsr->peekExecObjectsFilledCount());
+    EXPECT_EQ(11u, testedCsr->peekExecObjectsReusedCount());
+
+    csr->getResidencyAllocations().clear();
+    mm->freeGraphicsMemory(commandBuffer);
+    for (auto graphicsAllocation : graphicsAllocations) {
+        mm->freeGraphicsMemory(graphicsAllocation);
+    }
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenGemCloseWorkerInactiveModeWhenMakeResidentIsCalledThenRefCountsAreNotUpdated) {
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
 
@@ -898,6 +946,42 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, makeResidentTwice) {
     mm->freeGraphicsMemory(allocation);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenReusableBufferObjectsWhenMadeResidentMultipleTimesThenEachIsAddedToResidencyOnce) {
+    constexpr size_t allocationsCount = 1000u;
+    std::vector<DrmAllocation *> allocations;
+    for (size_t i = 0; i < allocationsCount; i++) {
+        auto buffer = this->createReusableBO(MemoryConstants::pageSize);
+        allocations.push_back(new DrmAllocation(0, GraphicsAllocation::AllocationType::UNKNOWN, buffer, nullptr, buffer->peekSize(), (osHandle)0u, MemoryPool::MemoryNull));
+    }
+
+    for (auto allocation : allocations) {
+        makeResidentBufferObjects<FamilyType>(allocation);
+        makeResidentBufferObjects<FamilyType>(allocation);
+    }
+    EXPECT_EQ(allocationsCount, getResidencyVector<FamilyType>().size());
+
+    for (auto allocation : allocations) {
+        makeResidentBufferObjects<FamilyType>(allocation);
+    }
+    EXPECT_EQ(allocationsCount, getResidencyVector<FamilyType>().size());
+
+    csr->makeResident(*allocations[0]);
+    csr->makeNonResident(*allocations[0]);
+    EXPECT_EQ(0u, getResidencyVector<FamilyType>().size());
+
+    for (auto allocation : allocations) {
+        makeResidentBufferObjects<FamilyType>(allocation);
+    }
+    EXPECT_EQ(allocationsCount, getResidencyVector<FamilyType>().size());
+
+    csr->makeResident(*allocations[0]);
+    csr->makeNonResident(*allocations[0]);
+    csr->getResidencyAllocations().clear();
+    for (auto allocation : allocations) {
+        mm->freeGraphicsMemory(allocation);
+    }
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, makeResidentTwiceWhenFragmentStorage) {
     auto ptr = (void *)0x1001;
     auto size = MemoryConstants::pageSize * 10;
@@ -27,6 +27,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 using namespace NEO;
 
@@ -35,6 +36,10 @@ class DrmMockForWorker : public Drm {
     std::mutex mutex;
     std::atomic<int> gem_close_cnt;
     std::atomic<int> gem_close_expected;
+    std::atomic<int> gem_wait_cnt{0};
+    std::atomic<int> gem_busy_cnt{0};
+    int busy_handle = -1;
+    std::vector<int> closed_handles;
     std::atomic<std::thread::id> ioctl_caller_thread_id;
     DrmMockForWorker() : Drm(33) {
     }
@@ -44,8 +49,17 @@ class DrmMockForWorker : public Drm {
             //main thread can hold mutex, to prevent ioctl handling
             std::lock_guard<std::mutex> lock(mutex);
         }
-        if (request == DRM_IOCTL_GEM_CLOSE)
+        if (request == DRM_IOCTL_GEM_CLOSE) {
             gem_close_cnt++;
+            closed_handles.push_back(static_cast<int>(reinterpret_cast<drm_gem_close *>(arg)->handle));
+        }
+        if (request == DRM_IOCTL_I915_GEM_WAIT)
+            gem_wait_cnt++;
+        if (request == DRM_IOCTL_I915_GEM_BUSY) {
+            gem_busy_cnt++;
+            auto busy = reinterpret_cast<drm_i915_gem_busy *>(arg);
+            busy->busy = (static_cast<int>(busy->handle) == busy_handle) ? 1u : 0u;
+        }
 
         ioctl_caller_thread_id = std::this_thread::get_id();
 
@@ -190,3 +204,80 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenPendingObjectsWhenBatchIsClosedThenOnlyNewestObjectIsWaitedOnAndObjectsAreClosedInPushOrder) {
+    struct mockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::closePendingObjects;
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+    };
+    this->drmMock->gem_close_expected = 6;
+
+    std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
+    worker->close(true);
+
+    for (int handle = 1; handle <= 6; handle++) {
+        worker->push(new BufferObject(this->drmMock, handle, 0));
+    }
+    EXPECT_EQ(6u, worker->getQueueDepth());
+
+    worker->closePendingObjects();
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(1, this->drmMock->gem_wait_cnt.load());
+    EXPECT_EQ(5, this->drmMock->gem_busy_cnt.load());
+    EXPECT_EQ(0u, worker->peekFallbackWaitCount());
+    EXPECT_EQ((std::vector<int>{1, 2, 3, 4, 5, 6}), this->drmMock->closed_handles);
+    EXPECT_EQ(1u, worker->peekBatchCount());
+    EXPECT_EQ(6u, worker->peekMaxQueueDepth());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenOlderObjectStillBusyAfterNewestIsIdleWhenBatchIsClosedThenItIsWaitedOnBeforeClose) {
+    struct mockDrmGemCloseWorker : DrmGemCloseWorker {
+        using DrmGemCloseWorker::closePendingObjects;
+        using DrmGemCloseWorker::DrmGemCloseWorker;
+    };
+    this->drmMock->gem_close_expected = 3;
+    this->drmMock->busy_handle = 2;
+
+    std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
+    worker->close(true);
+
+    for (int handle = 1; handle <= 3; handle++) {
+        worker->push(new BufferObject(this->drmMock, handle, 0));
+    }
+    worker->closePendingObjects();
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(2, this->drmMock->gem_wait_cnt.load());
+    EXPECT_EQ(1u, worker->peekFallbackWaitCount());
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), this->drmMock->closed_handles);
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenManyProducersWhenObjectsArePushedThenAllAreClosed) {
+    constexpr int numThreads = 4;
+    constexpr int numObjectsPerThread = 256;
+    this->drmMock->gem_close_expected = numThreads * numObjectsPerThread;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < numThreads; i++) {
+        producers.push_back(std::thread([&] {
+            for (int j = 0; j < numObjectsPerThread; j++) {
+                worker->push(new BufferObject(this->drmMock, j, 0));
+            }
+        }));
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    while (!worker->isEmpty() && (deadCnt-- > 0))
+        pthread_yield();
+
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_GE(worker->peekBatchCount(), 1u);
+    EXPECT_LE(worker->peekMaxQueueDepth(), static_cast<uint32_t>(numThreads * numObjectsPerThread));
+
+    delete worker;
+}
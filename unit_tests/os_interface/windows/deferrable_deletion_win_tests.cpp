@@ -6,6 +6,7 @@
  */
 
 #include "core/execution_environment/root_device_environment.h"
+#include "core/memory_manager/memory_constants.h"
 #include "runtime/os_interface/windows/deferrable_deletion_win.h"
 #include "unit_tests/mocks/mock_execution_environment.h"
 #include "unit_tests/mocks/mock_wddm.h"
@@ -42,6 +43,7 @@ class DeferrableDeletionTest : public ::testing::Test {
     const D3DKMT_HANDLE handle = 0;
     uint32_t allocationCount = 1;
     D3DKMT_HANDLE resourceHandle = 0;
+    size_t size = MemoryConstants::pageSize;
 
     void SetUp() override {
         executionEnvironment = std::make_unique<MockExecutionEnvironment>();
@@ -51,18 +53,19 @@ class DeferrableDeletionTest : public ::testing::Test {
 };
 
 TEST_F(DeferrableDeletionTest, givenDeferrableDeletionWhenIsCreatedThenObjectMembersAreSetProperly) {
-    MockDeferrableDeletion deletion(wddm.get(), &handle, allocationCount, resourceHandle);
+    MockDeferrableDeletion deletion(wddm.get(), &handle, allocationCount, resourceHandle, size);
     EXPECT_EQ(wddm.get(), deletion.wddm);
     EXPECT_NE(nullptr, deletion.handles);
     EXPECT_EQ(handle, *deletion.handles);
     EXPECT_NE(&handle, deletion.handles);
     EXPECT_EQ(allocationCount, deletion.allocationCount);
     EXPECT_EQ(resourceHandle, deletion.resourceHandle);
+    EXPECT_EQ(size, deletion.getSize());
 }
 
 TEST_F(DeferrableDeletionTest, givenDeferrableDeletionWhenApplyIsCalledThenDeletionIsApplied) {
     wddm->callBaseDestroyAllocations = false;
-    std::unique_ptr<DeferrableDeletion> deletion(DeferrableDeletion::create((Wddm *)wddm.get(), &handle, allocationCount, resourceHandle));
+    std::unique_ptr<DeferrableDeletion> deletion(DeferrableDeletion::create((Wddm *)wddm.get(), &handle, allocationCount, resourceHandle, size));
     EXPECT_EQ(0, wddm->destroyAllocationResult.called);
     deletion->apply();
     EXPECT_EQ(1, wddm->destroyAllocationResult.called);
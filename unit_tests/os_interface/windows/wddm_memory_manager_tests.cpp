@@ -24,6 +24,7 @@
 #include "runtime/utilities/tag_allocator.h"
 #include "unit_tests/helpers/execution_environment_helper.h"
 #include "unit_tests/helpers/unit_test_helper.h"
+#include "unit_tests/mocks/mock_deferrable_deletion.h"
 #include "unit_tests/mocks/mock_deferred_deleter.h"
 #include "unit_tests/mocks/mock_device.h"
 #include "unit_tests/mocks/mock_memory_manager.h"
@@ -1236,17 +1237,31 @@ struct WddmMemoryManagerWithAsyncDeleterTest : public MockWddmMemoryManagerTest
 
 TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenWddmWhenAsyncDeleterIsEnabledThenCanDeferDeletions) {
     EXPECT_EQ(0, deleter->deferDeletionCalled);
-    memoryManager->tryDeferDeletions(nullptr, 0, 0);
+    memoryManager->tryDeferDeletions(nullptr, 0, 0, 0u);
     EXPECT_EQ(1, deleter->deferDeletionCalled);
     EXPECT_EQ(1u, wddm->destroyAllocationResult.called);
 }
 
 TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenWddmWhenAsyncDeleterIsDisabledThenCannotDeferDeletions) {
     memoryManager->setDeferredDeleter(nullptr);
-    memoryManager->tryDeferDeletions(nullptr, 0, 0);
+    memoryManager->tryDeferDeletions(nullptr, 0, 0, 0u);
     EXPECT_EQ(1u, wddm->destroyAllocationResult.called);
 }
 
+TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenExhaustedMemoryBudgetWhenCallingIsMemoryBudgetExhaustedThenReadyDeferredDeletionsAreApplied) {
+    auto osContext = static_cast<OsContextWin *>(memoryManager->createAndRegisterOsContext(nullptr, aub_stream::ENGINE_RCS, 1, PreemptionHelper::getDefaultPreemptionMode(*platformDevices[0]), false));
+    auto deletion = new MockDeferrableDeletion();
+    deleter->DeferredDeleter::deferDeletion(deletion);
+
+    EXPECT_FALSE(memoryManager->isMemoryBudgetExhausted());
+    EXPECT_EQ(1, deleter->getElementsToRelease());
+
+    osContext->getResidencyController().setMemoryBudgetExhausted();
+    EXPECT_TRUE(memoryManager->isMemoryBudgetExhausted());
+    EXPECT_EQ(0, deleter->getElementsToRelease());
+    EXPECT_TRUE(deleter->isQueueEmpty());
+}
+
 TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenMemoryManagerWithAsyncDeleterWhenCannotAllocateMemoryForTiledImageThenDrainIsCalledAndCreateAllocationIsCalledTwice) {
     cl_image_desc imgDesc = {};
     imgDesc.image_type = CL_MEM_OBJECT_IMAGE3D;
@@ -5,10 +5,14 @@
  *
  */
 
+#include "core/helpers/file_io.h"
+#include "core/helpers/hw_helper.h"
 #include "core/helpers/hw_info.h"
 #include "core/helpers/options.h"
 #include "core/unit_tests/helpers/debug_manager_state_restore.h"
 #include "runtime/device/device.h"
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/os_context.h"
 #include "runtime/platform/extensions.h"
 #include "runtime/sharings/sharing_factory.h"
 #include "unit_tests/fixtures/mock_aub_center_fixture.h"
@@ -24,6 +28,10 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <cstdio>
+#include <set>
+#include <thread>
+
 using namespace NEO;
 
 namespace NEO {
@@ -172,6 +180,131 @@ TEST_F(PlatformTest, givenDisabledPreemptionActiveSourceLevelDebuggerWhenInitial
     EXPECT_GE(SipKernelType::DbgCsrLocal, MockSipData::calledType);
 }
 
+TEST_F(PlatformTest, givenLazyEngineInitializationAndMidThreadPreemptionWhenInitializingPlatformThenDoNotCallGetSipKernel) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+    DebugManager.flags.LazyEngineInitialization.set(true);
+
+    auto builtIns = new MockBuiltins();
+    pPlatform->peekExecutionEnvironment()->builtins.reset(builtIns);
+
+    pPlatform->initialize();
+    EXPECT_EQ(SipKernelType::COUNT, MockSipData::calledType);
+    EXPECT_FALSE(MockSipData::called);
+}
+
+TEST_F(PlatformTest, givenPlatformWhenInitializedThenInitializationTimesAreRecorded) {
+    EXPECT_TRUE(pPlatform->initialize());
+
+    auto &initializationTimes = pPlatform->peekInitializationTimes();
+    EXPECT_GE(initializationTimes.total, initializationTimes.getDevices + initializationTimes.memoryManager + initializationTimes.gmm +
+                                             initializationTimes.devices + initializationTimes.sipKernel);
+    EXPECT_GE(initializationTimes.devices, initializationTimes.engines);
+    EXPECT_EQ(pPlatform->getDevice(0)->peekEnginesInitializationTime(), initializationTimes.engines);
+}
+
+TEST_F(PlatformTest, givenPlatformInitializationTimesFileWhenInitializingPlatformThenTimesAreWrittenAsJson) {
+    DebugManagerStateRestore dbgRestorer;
+    std::string timesFileName = "platform_initialization_times.json";
+    DebugManager.flags.PlatformInitializationTimesFile.set(timesFileName);
+
+    EXPECT_TRUE(pPlatform->initialize());
+
+    size_t fileSize = 0;
+    auto fileData = loadDataFromFile(timesFileName.c_str(), fileSize);
+    ASSERT_NE(0u, fileSize);
+    std::string json(fileData.get(), fileSize);
+    std::remove(timesFileName.c_str());
+
+    auto &initializationTimes = pPlatform->peekInitializationTimes();
+    EXPECT_EQ('{', json.front());
+    EXPECT_THAT(json, ::testing::HasSubstr("\"total\": " + std::to_string(initializationTimes.total)));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"engines\": " + std::to_string(initializationTimes.engines)));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"numDevices\": " + std::to_string(pPlatform->getNumDevices())));
+}
+
+TEST_F(PlatformTest, givenPrintPlatformInitializationTimesWhenInitializingPlatformThenTimesArePrinted) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.PrintPlatformInitializationTimes.set(true);
+
+    testing::internal::CaptureStdout();
+    EXPECT_TRUE(pPlatform->initialize());
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_THAT(output, ::testing::HasSubstr(std::string("Platform initialization times [us]: getDevices ")));
+}
+
+TEST(PlatformParallelInitializationTest, givenParallelDeviceInitializationAndMultipleRootDevicesWhenInitializingPlatformThenAllDevicesAreCreated) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.CreateMultipleRootDevices.set(2);
+    DebugManager.flags.ParallelDeviceInitialization.set(true);
+    VariableBackup<bool> backup(&overrideDeviceWithDefaultHardwareInfo, false);
+
+    Platform platform;
+    EXPECT_TRUE(platform.initialize());
+    ASSERT_EQ(2u, platform.getNumDevices());
+
+    auto numGpgpuEngines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances().size();
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < 2u; rootDeviceIndex++) {
+        auto device = platform.getDevice(rootDeviceIndex);
+        ASSERT_NE(nullptr, device);
+        EXPECT_EQ(rootDeviceIndex, device->getRootDeviceIndex());
+    }
+    EXPECT_NE(platform.getDevice(0)->getDefaultEngine().commandStreamReceiver, platform.getDevice(1)->getDefaultEngine().commandStreamReceiver);
+
+    auto registeredEngines = platform.peekExecutionEnvironment()->memoryManager->getRegisteredEngines();
+    std::set<uint32_t> contextIds;
+    for (auto &engine : registeredEngines) {
+        contextIds.insert(engine.osContext->getContextId());
+    }
+    EXPECT_EQ(2 * numGpgpuEngines, registeredEngines.size());
+    EXPECT_EQ(registeredEngines.size(), contextIds.size());
+}
+
+TEST(PlatformParallelInitializationTest, givenParallelAndLazyEngineInitializationAndMultipleRootDevicesWhenEnginesAreRequestedConcurrentlyThenEachIsRegisteredOnce) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.CreateMultipleRootDevices.set(2);
+    DebugManager.flags.ParallelDeviceInitialization.set(true);
+    DebugManager.flags.LazyEngineInitialization.set(true);
+    VariableBackup<bool> backup(&overrideDeviceWithDefaultHardwareInfo, false);
+
+    Platform platform;
+    EXPECT_TRUE(platform.initialize());
+    ASSERT_EQ(2u, platform.getNumDevices());
+
+    auto memoryManager = platform.peekExecutionEnvironment()->memoryManager.get();
+    EXPECT_EQ(2u, memoryManager->getRegisteredEnginesCount());
+
+    auto gpgpuEngines = HwHelper::get(platformDevices[0]->platform.eRenderCoreFamily).getGpgpuEngineInstances();
+    auto lowPriorityEngineType = gpgpuEngines[HwHelper::lowPriorityGpgpuEngineIndex];
+    EngineControl *lowPriorityEngines[2] = {};
+
+    std::vector<std::thread> threads;
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < 2u; rootDeviceIndex++) {
+        threads.emplace_back([&, rootDeviceIndex]() {
+            lowPriorityEngines[rootDeviceIndex] = &platform.getDevice(rootDeviceIndex)->getEngine(lowPriorityEngineType, true);
+        });
+    }
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        EXPECT_NE(nullptr, engine.commandStreamReceiver);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_NE(lowPriorityEngines[0]->commandStreamReceiver, lowPriorityEngines[1]->commandStreamReceiver);
+    EXPECT_EQ(lowPriorityEngines[0], &platform.getDevice(0)->getEngine(lowPriorityEngineType, true));
+    EXPECT_EQ(lowPriorityEngines[1], &platform.getDevice(1)->getEngine(lowPriorityEngineType, true));
+
+    auto registeredEngines = memoryManager->getRegisteredEngines();
+    std::set<uint32_t> contextIds;
+    for (auto &engine : registeredEngines) {
+        contextIds.insert(engine.osContext->getContextId());
+    }
+    EXPECT_EQ(4u, registeredEngines.size());
+    EXPECT_EQ(registeredEngines.size(), contextIds.size());
+}
+
 TEST(PlatformTestSimple, givenCsrHwTypeWhenPlatformIsInitializedThenInitAubCenterIsNotCalled) {
     DebugManagerStateRestore stateRestore;
     DebugManager.flags.SetCommandStreamReceiver.set(0);
@@ -98,6 +98,40 @@ __kernel void FillBufferRightLeftover(
     pDst[ gid + dstOffsetInBytes ] = pPattern[ gid & (patternSizeInEls - 1) ];
 }
 
+// pattern of up to 16 bytes passed by value, patternSizeInEls is a power of two
+__kernel void FillBufferImmediateLeftLeftover(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const uint4 pattern,
+    const uint patternSizeInEls )
+{
+    uint gid = get_global_id(0);
+    const uint patternArray[4] = { pattern.x, pattern.y, pattern.z, pattern.w };
+    pDst[ gid + dstOffsetInBytes ] = ((const uchar*)patternArray)[ gid & (patternSizeInEls - 1) ];
+}
+
+__kernel void FillBufferImmediateMiddle(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const uint4 pattern,
+    const uint patternSizeInEls )
+{
+    uint gid = get_global_id(0);
+    const uint patternArray[4] = { pattern.x, pattern.y, pattern.z, pattern.w };
+    ((__global uint*)(pDst + dstOffsetInBytes))[gid] = patternArray[ gid & (patternSizeInEls - 1) ];
+}
+
+__kernel void FillBufferImmediateRightLeftover(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const uint4 pattern,
+    const uint patternSizeInEls )
+{
+    uint gid = get_global_id(0);
+    const uint patternArray[4] = { pattern.x, pattern.y, pattern.z, pattern.w };
+    pDst[ gid + dstOffsetInBytes ] = ((const uchar*)patternArray)[ gid & (patternSizeInEls - 1) ];
+}
+
 __kernel void FillImage1d(
     __write_only image1d_t output,
     uint4 color,
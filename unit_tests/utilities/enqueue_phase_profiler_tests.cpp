@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/enqueue_phase_profiler.h"
+#include "test.h"
+#include "unit_tests/fixtures/device_fixture.h"
+#include "unit_tests/helpers/variable_backup.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_kernel.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace NEO;
+
+TEST(EnqueuePhaseProfilerTest, givenNoProfilerInstalledWhenPhaseScopeEndsThenNothingIsRecorded) {
+    EnqueuePhaseProfiler profiler;
+    VariableBackup<EnqueuePhaseProfiler *> profilerBackup(&gEnqueuePhaseProfiler, nullptr);
+    {
+        EnqueuePhaseScope phaseScope(EnqueuePhase::Flush);
+    }
+    EXPECT_EQ(0u, profiler.getCallsCount(EnqueuePhase::Flush));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenProfilerInstalledWhenPhaseScopeEndsThenCallAndTimeAreRecorded) {
+    EnqueuePhaseProfiler profiler;
+    VariableBackup<EnqueuePhaseProfiler *> profilerBackup(&gEnqueuePhaseProfiler, &profiler);
+    {
+        EnqueuePhaseScope phaseScope(EnqueuePhase::FlushTask);
+    }
+    profiler.record(EnqueuePhase::FlushTask, std::chrono::nanoseconds(100));
+
+    EXPECT_EQ(2u, profiler.getCallsCount(EnqueuePhase::FlushTask));
+    EXPECT_LE(100u, profiler.getTotalTimeNs(EnqueuePhase::FlushTask));
+    EXPECT_EQ(0u, profiler.getCallsCount(EnqueuePhase::Flush));
+
+    profiler.reset();
+    EXPECT_EQ(0u, profiler.getCallsCount(EnqueuePhase::FlushTask));
+    EXPECT_EQ(0u, profiler.getTotalTimeNs(EnqueuePhase::FlushTask));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenNestedPhaseScopesWhenTheyEndThenOuterPhaseRecordsOnlyItsExclusiveTime) {
+    EnqueuePhaseProfiler profiler;
+    VariableBackup<EnqueuePhaseProfiler *> profilerBackup(&gEnqueuePhaseProfiler, &profiler);
+
+    auto start = std::chrono::steady_clock::now();
+    {
+        EnqueuePhaseScope flushTaskScope(EnqueuePhase::FlushTask);
+        {
+            EnqueuePhaseScope flushScope(EnqueuePhase::Flush);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    auto elapsedNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::FlushTask));
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::Flush));
+    EXPECT_LE(2000000u, profiler.getTotalTimeNs(EnqueuePhase::Flush));
+    EXPECT_LE(profiler.getTotalTimeNs(EnqueuePhase::FlushTask) + profiler.getTotalTimeNs(EnqueuePhase::Flush), elapsedNs);
+
+    {
+        EnqueuePhaseScope flushScope(EnqueuePhase::Flush);
+    }
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::FlushTask));
+    EXPECT_EQ(2u, profiler.getCallsCount(EnqueuePhase::Flush));
+}
+
+TEST(EnqueuePhaseProfilerTest, whenGettingPhaseNameThenEnqueueHandlerFunctionNameIsReturned) {
+    EXPECT_STREQ("obtainTaskLevelAndBlockedStatus", EnqueuePhaseProfiler::getPhaseName(EnqueuePhase::ObtainTaskLevelAndBlockedStatus));
+    EXPECT_STREQ("processDispatchForKernels", EnqueuePhaseProfiler::getPhaseName(EnqueuePhase::ProcessDispatchForKernels));
+    EXPECT_STREQ("flushTask", EnqueuePhaseProfiler::getPhaseName(EnqueuePhase::FlushTask));
+    EXPECT_STREQ("flush", EnqueuePhaseProfiler::getPhaseName(EnqueuePhase::Flush));
+    EXPECT_STREQ("unknown", EnqueuePhaseProfiler::getPhaseName(EnqueuePhase::Count));
+}
+
+using EnqueuePhaseProfilerEnqueueTest = Test<DeviceFixture>;
+
+HWTEST_F(EnqueuePhaseProfilerEnqueueTest, givenProfilerInstalledWhenKernelIsEnqueuedThenEachEnqueueHandlerPhaseIsRecorded) {
+    MockContext context(pDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pDevice, &context);
+    size_t gws[3] = {1, 1, 1};
+
+    EnqueuePhaseProfiler profiler;
+    VariableBackup<EnqueuePhaseProfiler *> profilerBackup(&gEnqueuePhaseProfiler, &profiler);
+
+    auto retVal = cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::ObtainTaskLevelAndBlockedStatus));
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::ProcessDispatchForKernels));
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::FlushTask));
+    EXPECT_EQ(1u, profiler.getCallsCount(EnqueuePhase::Flush));
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "core/unit_tests/helpers/debug_manager_state_restore.h"
+#include "runtime/api/api.h"
+#include "runtime/utilities/object_pool.h"
+#include "unit_tests/mocks/mock_context.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+struct PoolableTestObject : public PoolableObject {
+    uint64_t payload[4] = {};
+};
+
+struct LargePoolableTestObject : public PoolableObject {
+    uint8_t payload[ObjectPool::maxSlotSize] = {};
+};
+
+struct ObjectPoolTest : public ::testing::Test {
+    void SetUp() override {
+        objectPool = new ObjectPool();
+        objectPool->incRefInternal();
+    }
+
+    void TearDown() override {
+        objectPool->decRefInternal();
+    }
+
+    ObjectPool *objectPool = nullptr;
+};
+} // namespace
+
+TEST_F(ObjectPoolTest, givenObjectDeletedWhenNextObjectIsCreatedFromPoolThenSlotIsReused) {
+    auto object = new (objectPool) PoolableTestObject();
+    EXPECT_EQ(1u, objectPool->getSlabsCount());
+    EXPECT_EQ(2, objectPool->getRefInternalCount());
+
+    delete object;
+    EXPECT_EQ(1, objectPool->getRefInternalCount());
+
+    auto reusedObject = new (objectPool) PoolableTestObject();
+    EXPECT_EQ(object, reusedObject);
+    EXPECT_EQ(1u, objectPool->getSlabsCount());
+    delete reusedObject;
+}
+
+TEST_F(ObjectPoolTest, givenMoreObjectsThanSlabSlotsWhenCreatedFromPoolThenNextSlabIsAdded) {
+    std::vector<PoolableTestObject *> objects;
+    for (size_t i = 0; i < ObjectPool::slotsPerSlab + 1; i++) {
+        objects.push_back(new (objectPool) PoolableTestObject());
+    }
+    EXPECT_EQ(2u, objectPool->getSlabsCount());
+
+    for (auto object : objects) {
+        delete object;
+    }
+}
+
+TEST_F(ObjectPoolTest, givenNoPoolOrTooLargeObjectWhenCreatedThenGlobalHeapIsUsed) {
+    auto heapObject = new PoolableTestObject();
+    auto objectWithoutPool = new (nullptr) PoolableTestObject();
+    auto largeObject = new (objectPool) LargePoolableTestObject();
+
+    EXPECT_EQ(0u, objectPool->getSlabsCount());
+    EXPECT_EQ(1, objectPool->getRefInternalCount());
+
+    delete heapObject;
+    delete objectWithoutPool;
+    delete largeObject;
+}
+
+TEST_F(ObjectPoolTest, givenObjectPoolingDisabledWhenObjectIsCreatedFromPoolThenGlobalHeapIsUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableObjectPooling.set(false);
+
+    auto object = new (objectPool) PoolableTestObject();
+    EXPECT_EQ(0u, objectPool->getSlabsCount());
+    delete object;
+}
+
+TEST(ObjectPoolLifetimeTest, givenPoolReleasedByOwnerWhenLastObjectIsDeletedThenPoolIsDestroyed) {
+    auto objectPool = new ObjectPool();
+    objectPool->incRefInternal();
+
+    auto object = new (objectPool) PoolableTestObject();
+    objectPool->decRefInternal();
+    EXPECT_EQ(1, objectPool->getRefInternalCount());
+
+    delete object;
+}
+
+TEST(ObjectPoolContextTest, givenUserEventReleasedWhenNextUserEventIsCreatedOnSameContextThenItReusesPooledMemory) {
+    MockContext context;
+    cl_int retVal = CL_SUCCESS;
+
+    auto userEvent = clCreateUserEvent(&context, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto slabsCount = context.getObjectPool()->getSlabsCount();
+    EXPECT_NE(0u, slabsCount);
+    clReleaseEvent(userEvent);
+
+    auto nextUserEvent = clCreateUserEvent(&context, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(userEvent, nextUserEvent);
+    EXPECT_EQ(slabsCount, context.getObjectPool()->getSlabsCount());
+    clReleaseEvent(nextUserEvent);
+}
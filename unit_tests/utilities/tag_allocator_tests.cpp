@@ -13,6 +13,7 @@
 #include "gtest/gtest.h"
 
 #include <cstdint>
+#include <thread>
 
 using namespace NEO;
 
@@ -44,10 +45,13 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::freeTags;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
+    using BaseClass::threadCacheCapacity;
     using BaseClass::usedTags;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment, bool disableCompletionCheck)
         : BaseClass(0, memMngr, tagCount, tagAlignment, sizeof(TagType), disableCompletionCheck) {
+        // tests below track released tags on the free list
+        this->threadCacheCapacity = 0;
     }
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment)
@@ -401,6 +405,116 @@ TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTags
     EXPECT_FALSE(tagAllocator.freeTags.peekIsEmpty());
 }
 
+TEST_F(TagAllocatorTest, givenCompletedTagsAtFrontOfDeferredListWhenReleasingItThenOnlyCompletedPrefixIsMovedToFreePool) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 3, 1); // pool with 3 tags
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    auto node3 = tagAllocator.getTag();
+
+    node1->tagForCpuAccess->release = false;
+    node2->tagForCpuAccess->release = false;
+    node3->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+    tagAllocator.returnTag(node3);
+    EXPECT_EQ(node1, tagAllocator.deferredTags.peekHead());
+    EXPECT_EQ(node3, tagAllocator.deferredTags.peekTail());
+
+    node1->tagForCpuAccess->release = true;
+    node2->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*node1));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*node2));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*node3));
+    EXPECT_EQ(node3, tagAllocator.deferredTags.peekHead());
+    EXPECT_EQ(node3, tagAllocator.deferredTags.peekTail());
+
+    node3->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*node3));
+}
+
+TEST_F(TagAllocatorTest, givenBusyTagAtFrontOfDeferredListWhenReleasingItThenCompletedTagsBehindItAreMovedToFreePool) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 3, 1); // pool with 3 tags
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    auto node3 = tagAllocator.getTag();
+
+    node1->tagForCpuAccess->release = false;
+    node2->tagForCpuAccess->release = false;
+    node3->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+    tagAllocator.returnTag(node3);
+
+    node3->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*node3));
+    EXPECT_EQ(node1, tagAllocator.deferredTags.peekHead());
+    EXPECT_EQ(node2, tagAllocator.deferredTags.peekTail());
+
+    node1->tagForCpuAccess->release = true;
+    node2->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+}
+
+TEST_F(TagAllocatorTest, givenTagsDeferredAfterBusyTagsWereDetachedWhenBusyTagsArePutBackThenTheyStayInFront) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 3, 1); // pool with 3 tags
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    auto node3 = tagAllocator.getTag();
+
+    node1->tagForCpuAccess->release = false;
+    node2->tagForCpuAccess->release = false;
+    node3->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+
+    auto detachedTags = tagAllocator.deferredTags.detachNodes();
+    tagAllocator.returnTag(node3);
+    tagAllocator.deferredTags.spliceFront(*detachedTags);
+
+    EXPECT_EQ(node1, tagAllocator.deferredTags.peekHead());
+    EXPECT_EQ(node2, node1->next);
+    EXPECT_EQ(node3, tagAllocator.deferredTags.peekTail());
+
+    node1->tagForCpuAccess->release = true;
+    node2->tagForCpuAccess->release = true;
+    node3->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+}
+
+TEST_F(TagAllocatorTest, givenThreadCacheWhenTagsAreReturnedThenCachedTagsAreReusedBeforeNewPoolIsAllocated) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1); // pool with 2 tags
+    tagAllocator.threadCacheCapacity = 1;
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    node1->tagForCpuAccess->release = true;
+    node2->tagForCpuAccess->release = true;
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*node1));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*node2));
+
+    EXPECT_EQ(node1, tagAllocator.getTag());
+    EXPECT_EQ(node2, tagAllocator.getTag());
+    tagAllocator.returnTag(node1);
+
+    // thread taking the tag may use another cache, it still gets the cached tag before a new pool is allocated
+    TagNode<TimeStamps> *nodeFromOtherThread = nullptr;
+    std::thread([&] { nodeFromOtherThread = tagAllocator.getTag(); }).join();
+    EXPECT_EQ(node1, nodeFromOtherThread);
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     TagAllocator<TimestampPacketStorage> timestampPacketAllocator(0, memoryManager, 1, 1, sizeof(TimestampPacketStorage), false);
     TagAllocator<HwTimeStamps> hwTimeStampsAllocator(0, memoryManager, 1, 1, sizeof(HwTimeStamps), false);